@@ -81,7 +81,9 @@ def solver_library_config(library_name: str, paths: list) -> tuple:
 cppgambit_bimatrix = solver_library_config("cppgambit_bimatrix",
                                            ["linalg", "lp", "lcp", "enummixed"])
 cppgambit_liap = solver_library_config("cppgambit_liap", ["liap"])
+cppgambit_homotopy = solver_library_config("cppgambit_homotopy", ["homotopy"])
 cppgambit_logit = solver_library_config("cppgambit_logit", ["logit"])
+cppgambit_tracing = solver_library_config("cppgambit_tracing", ["tracing"])
 cppgambit_gtracer = solver_library_config("cppgambit_gtracer", ["gtracer", "ipa", "gnm"])
 cppgambit_simpdiv = solver_library_config("cppgambit_simpdiv", ["simpdiv"])
 cppgambit_enumpoly = solver_library_config("cppgambit_enumpoly", ["nashsupport", "enumpoly"])
@@ -137,8 +139,8 @@ setuptools.setup(
         "scipy",
         "deprecated",
     ],
-    libraries=[cppgambit_bimatrix, cppgambit_liap, cppgambit_logit, cppgambit_simpdiv,
-               cppgambit_gtracer, cppgambit_enumpoly,
+    libraries=[cppgambit_bimatrix, cppgambit_liap, cppgambit_logit, cppgambit_tracing,
+               cppgambit_homotopy, cppgambit_simpdiv, cppgambit_gtracer, cppgambit_enumpoly,
                cppgambit_games, cppgambit_core],
     package_dir={"": "src"},
     packages=["pygambit"],
@@ -26,11 +26,14 @@
 namespace Gambit {
 
 template class Matrix<double>;
+template class Matrix<long double>;
 template class Matrix<Rational>;
 template class Matrix<Integer>;
 template class Matrix<int>;
 
 template Vector<double> operator*(const Vector<double> &, const Matrix<double> &);
+template Vector<long double> operator*(const Vector<long double> &,
+                                      const Matrix<long double> &);
 template Vector<Rational> operator*(const Vector<Rational> &, const Matrix<Rational> &);
 template Vector<Integer> operator*(const Vector<Integer> &, const Matrix<Integer> &);
 template Vector<int> operator*(const Vector<int> &, const Matrix<int> &);
@@ -0,0 +1,98 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/core/parallel.h
+// Simple parallel loops over independent tasks
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef LIBGAMBIT_PARALLEL_H
+#define LIBGAMBIT_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Gambit {
+
+/// The number of threads used by default for parallel computations:
+/// the number of hardware threads, or one if that cannot be determined.
+inline int DefaultThreadCount()
+{
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+/// Calls p_task(i) for each i from 0 to p_count - 1, sharing the calls
+/// among up to p_threads threads, one of which is the calling thread.
+/// Tasks are handed out in increasing order of i as threads become free,
+/// so tasks of uneven cost are balanced.  If p_threads is less than one,
+/// DefaultThreadCount() threads are used.
+///
+/// If a task throws, no further tasks are started, and the first exception
+/// thrown is rethrown on the calling thread once all threads have finished.
+template <class Task> void ParallelFor(int p_count, int p_threads, Task p_task)
+{
+  if (p_threads < 1) {
+    p_threads = DefaultThreadCount();
+  }
+  p_threads = std::min(p_threads, p_count);
+  if (p_threads <= 1) {
+    for (int i = 0; i < p_count; i++) {
+      p_task(i);
+    }
+    return;
+  }
+
+  std::atomic<int> next(0);
+  std::atomic<bool> failed(false);
+  std::exception_ptr error;
+  std::mutex errorMutex;
+  auto worker = [&]() {
+    for (int i = next++; i < p_count && !failed; i = next++) {
+      try {
+        p_task(i);
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        failed = true;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(p_threads - 1);
+  for (int t = 1; t < p_threads; t++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+} // end namespace Gambit
+
+#endif // LIBGAMBIT_PARALLEL_H
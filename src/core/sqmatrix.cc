@@ -24,4 +24,5 @@
 #include "rational.h"
 
 template class Gambit::SquareMatrix<double>;
+template class Gambit::SquareMatrix<long double>;
 template class Gambit::SquareMatrix<Gambit::Rational>;
@@ -37,13 +37,12 @@ AGG::AGG(int numPlayers, std::vector<int> &_actions, int numANodes, int _numPNod
          vector<vector<int>> &_actionSets, vector<vector<int>> &neighb,
          vector<projtype> &projTypes, vector<vector<aggdistrib>> &projS,
          vector<vector<vector<config>>> &proj, vector<vector<projtype>> &projF,
-         vector<vector<vector<int>>> &Po, vector<aggdistrib> &P, vector<aggpayoff> &_payoffs)
+         vector<vector<vector<int>>> &Po, vector<aggpayoff> &_payoffs)
   : numPlayers(numPlayers), totalActions(0), maxActions(0), numActionNodes(numANodes),
     numPNodes(_numPNodes), actionSets(_actionSets), neighbors(neighb), projectionTypes(projTypes),
-    payoffs(_payoffs), projection(proj), projectedStrat(projS), fullProjectedStrat(projS),
-    projFunctions(projF), Porder(Po), Pr(P), isPure(numANodes, true),
-    node2Action(numANodes, vector<int>(numPlayers)), cache(numPlayers + 1),
-    player2Class(numPlayers), kSymStrategyOffset(1, 0)
+    payoffs(_payoffs), projection(proj), fullProjectedStrat(projS), projFunctions(projF),
+    Porder(Po), isPure(numANodes, true), node2Action(numANodes, vector<int>(numPlayers)),
+    player2Class(numPlayers), kSymStrategyOffset(1, 0), workspace(*this)
 
 {
   // actions
@@ -115,6 +114,11 @@ AGG::AGG(int numPlayers, std::vector<int> &_actions, int numANodes, int _numPNod
   }
 }
 
+AGG::Workspace::Workspace(const AGG &agg)
+  : projectedStrat(agg.numActionNodes, vector<aggdistrib>(agg.numPlayers)), Pr(agg.numPlayers)
+{
+}
+
 namespace {
 
 void stripComment(istream &in)
@@ -286,7 +290,7 @@ std::shared_ptr<AGG> AGG::makeAGG(istream &in)
       throw std::runtime_error("Unknown payoff type " + std::to_string(t));
     }
   }
-  return std::make_shared<AGG>(n, size, S, P, ASets, neighb, projTypes, projS, proj, projF, Po, Pr,
+  return std::make_shared<AGG>(n, size, S, P, ASets, neighb, projTypes, projS, proj, projF, Po,
                                pays);
 }
 
@@ -385,8 +389,9 @@ void AGG::initPorder(vector<int> &Po, int i, int N, vector<aggdistrib> &projS)
 }
 
 // compute the induced distribution
-void AGG::computeP(int player, int act, int player2, int act2)
+void AGG::computeP(Workspace &w, int player, int act, int player2, int act2) const
 {
+  vector<aggdistrib> &Pr = w.Pr;
   // apply player's strat
   Pr[0].reset();
   Pr[0].insert(make_pair(projection[actionSets[player][act]][player][act], 1.0));
@@ -402,36 +407,35 @@ void AGG::computeP(int player, int act, int player2, int act2)
       }
       else {
         // apply player2's pure strat
-        aggdistrib temp;
-        temp.insert(make_pair(projection[actionSets[player][act]][player2][act2], 1.0));
-        Pr[k].multiply(Pr[k - 1], temp, numNei, projFunctions[actionSets[player][act]]);
+        Pr[k].multiply(Pr[k - 1], projection[actionSets[player][act]][player2][act2], numNei,
+                       projFunctions[actionSets[player][act]]);
       }
     }
     else {
-      Pr[k].multiply(Pr[k - 1], projectedStrat[actionSets[player][act]][Porder[player][act][k]],
+      Pr[k].multiply(Pr[k - 1], w.projectedStrat[actionSets[player][act]][Porder[player][act][k]],
                      numNei, projFunctions[actionSets[player][act]]);
     }
   }
 }
 
-void AGG::doProjection(int Node, AggNumber *s)
+void AGG::doProjection(Workspace &w, int Node, const AggNumber *s) const
 {
   for (int i = 0; i < numPlayers; i++) {
-    doProjection(Node, i, &(s[firstAction(i)]));
+    doProjection(w, Node, i, &(s[firstAction(i)]));
   }
 }
 
-void AGG::doProjection(int Node, int i, AggNumber *s)
+void AGG::doProjection(Workspace &w, int Node, int i, const AggNumber *s) const
 {
-  projectedStrat[Node][i].reset();
+  w.projectedStrat[Node][i].reset();
   for (int j = 0; j < actions[i]; j++) {
     if (s[j] > (AggNumber)0.0) {
-      projectedStrat[Node][i] += make_pair(projection[Node][i][j], s[j]);
+      w.projectedStrat[Node][i] += make_pair(projection[Node][i][j], s[j]);
     }
   }
 }
 
-AggNumber AGG::getPurePayoff(int player, const std::vector<int> &s)
+AggNumber AGG::getPurePayoff(int player, const std::vector<int> &s) const
 {
   assert(player >= 0 && player < numPlayers);
   int Node = actionSets[player][s[player]];
@@ -454,39 +458,41 @@ AggNumber AGG::getPurePayoff(int player, const std::vector<int> &s)
   return p->second;
 }
 
-AggNumber AGG::getMixedPayoff(int player, StrategyProfile &s)
+AggNumber AGG::getMixedPayoff(Workspace &w, int player, const StrategyProfile &s) const
 {
   AggNumber result = 0.0;
   assert(player >= 0 && player < numPlayers);
   for (int act = 0; act < actions[player]; ++act) {
     if (s[act + firstAction(player)] > (AggNumber)0.0) {
-      result += s[act + firstAction(player)] * getV(player, act, s);
+      result += s[act + firstAction(player)] * getV(w, player, act, s);
     }
   }
   return result;
 }
 
-void AGG::getPayoffVector(AggNumberVector &dest, int player, const StrategyProfile &s)
+void AGG::getPayoffVector(Workspace &w, AggNumberVector &dest, int player,
+                          const StrategyProfile &s) const
 {
   assert(player >= 0 && player < numPlayers);
   for (int act = 0; act < actions[player]; ++act) {
-    dest[act] = getV(player, act, s);
+    dest[act] = getV(w, player, act, s);
   }
 }
 
-AggNumber AGG::getV(int player, int act, const StrategyProfile &s)
+AggNumber AGG::getV(Workspace &w, int player, int act, const StrategyProfile &s) const
 {
   // project s to the projectedStrat
-  doProjection(actionSets.at(player).at(act), s);
-  computeP(player, act);
-  return Pr[numPlayers - 1].inner_prod(payoffs[actionSets[player][act]]);
+  doProjection(w, actionSets.at(player).at(act), s);
+  computeP(w, player, act);
+  return w.Pr[numPlayers - 1].inner_prod(payoffs[actionSets[player][act]]);
 }
 
-AggNumber AGG::getJ(int player1, int act1, int player2, int act2, StrategyProfile &s)
+AggNumber AGG::getJ(Workspace &w, int player1, int act1, int player2, int act2,
+                    const StrategyProfile &s) const
 {
-  doProjection(actionSets[player1][act1], s);
-  computeP(player1, act1, player2, act2);
-  return Pr[numPlayers - 1].inner_prod(payoffs[actionSets[player1][act1]]);
+  doProjection(w, actionSets[player1][act1], s);
+  computeP(w, player1, act1, player2, act2);
+  return w.Pr[numPlayers - 1].inner_prod(payoffs[actionSets[player1][act1]]);
 }
 
 // getSymMixedPayoff: compute expected payoff under a symmetric mixed strat,
@@ -494,7 +500,7 @@ AggNumber AGG::getJ(int player1, int act1, int player2, int act2, StrategyProfil
 //  parameter: s is the mixed strategy of one player. It is a vector of
 //  probabilities, indexed by the action node.
 
-AggNumber AGG::getSymMixedPayoff(StrategyProfile &s)
+AggNumber AGG::getSymMixedPayoff(Workspace &w, const StrategyProfile &s) const
 {
   AggNumber result = 0;
   if (!isSymmetric()) {
@@ -503,34 +509,34 @@ AggNumber AGG::getSymMixedPayoff(StrategyProfile &s)
 
   for (int node = 0; node < numActionNodes; ++node) {
     if (s[node] > (AggNumber)0.0) {
-      result += s[node] * getSymMixedPayoff(node, s);
+      result += s[node] * getSymMixedPayoff(w, node, s);
     }
   }
   return result;
 }
 
-void AGG::getSymPayoffVector(AggNumberVector &dest, StrategyProfile &s)
+void AGG::getSymPayoffVector(Workspace &w, AggNumberVector &dest, const StrategyProfile &s) const
 {
   if (!isSymmetric()) {
     throw std::runtime_error("AGG::getSymMixedPayoff: the game is not symmetric");
   }
   for (int act = 0; act < numActionNodes; ++act) {
-    dest[act] = getSymMixedPayoff(act, s);
+    dest[act] = getSymMixedPayoff(w, act, s);
   }
 }
 
-AggNumber AGG::getSymMixedPayoff(int node, StrategyProfile &s)
+AggNumber AGG::getSymMixedPayoff(Workspace &w, int node, const StrategyProfile &s) const
 {
   int numNei = neighbors[node].size();
 
-  if (!isPure[node]) { // then compute EU using trie_map::power()
-    doProjection(node, 0, s);
+  if (!isPure[node]) { // then compute EU using config_map::power()
+    doProjection(w, node, 0, s);
     assert(numPlayers > 1);
     // aggdistrib *dest;
     // projectedStrat[node][0].power(numPlayers-1, dest, Pr, numNei,projFunctions[node]);
-    aggdistrib &dest = Pr[numPlayers - 1];
-    projectedStrat[node][0].power(numPlayers - 1, dest, Pr[numPlayers - 2], numNei,
-                                  projFunctions[node]);
+    aggdistrib &dest = w.Pr[numPlayers - 1];
+    w.projectedStrat[node][0].power(numPlayers - 1, dest, w.Pr[numPlayers - 2], numNei,
+                                    projFunctions[node]);
     return dest.inner_prod(projection[node][0][node], numNei, projFunctions[node], payoffs[node]);
   }
 
@@ -593,8 +599,8 @@ AggNumber AGG::getSymMixedPayoff(int node, StrategyProfile &s)
 // plClass: the index for the player class
 // s: mixed strat for that player class
 
-void AGG::getSymConfigProb(int plClass, StrategyProfile &s, int ownPlClass, int act,
-                           aggdistrib &dest, int plClass2, int act2)
+void AGG::getSymConfigProb(Workspace &w, int plClass, const StrategyProfile &s, int ownPlClass,
+                           int act, aggdistrib &dest, int plClass2, int act2) const
 {
   int node = uniqueActionSets.at(ownPlClass).at(act);
   int numPl = playerClasses.at(plClass).size();
@@ -611,35 +617,29 @@ void AGG::getSymConfigProb(int plClass, StrategyProfile &s, int ownPlClass, int
 
   if (!isPure[node]) {
     int player = playerClasses[plClass].at(0);
-    projectedStrat[node][player].reset();
+    w.projectedStrat[node][player].reset();
     if (numPl > 0) {
       for (int j = 0; j < actions[player]; j++) {
         if (s[j] > (AggNumber)0.0) {
-          projectedStrat[node][player] += make_pair(projection[node][player][j], s[j]);
+          w.projectedStrat[node][player] += make_pair(projection[node][player][j], s[j]);
         }
       }
-      projectedStrat[node][player].power(numPl, dest, Pr[0], numNei, projFunctions[node]);
+      w.projectedStrat[node][player].power(numPl, dest, w.Pr[0], numNei, projFunctions[node]);
     }
     if (plClass == ownPlClass) {
-      aggdistrib temp;
-      temp.insert(make_pair(projection[node][player].at(act), 1.0));
       if (dest.size() > 0) {
-        dest.multiply(temp, numNei, projFunctions[node]);
+        dest.multiply(projection[node][player].at(act), numNei, projFunctions[node]);
       }
       else {
-        // dest.swap(temp);
-        dest = temp;
+        dest.insert(make_pair(projection[node][player].at(act), 1.0));
       }
     }
     if (plClass == plClass2) {
-      aggdistrib temp;
-      temp.insert(make_pair(projection[node][player].at(act2), 1.0));
       if (dest.size() > 0) {
-        dest.multiply(temp, numNei, projFunctions[node]);
+        dest.multiply(projection[node][player].at(act2), numNei, projFunctions[node]);
       }
       else {
-        // dest.swap(temp);
-        dest = temp;
+        dest.insert(make_pair(projection[node][player].at(act2), 1.0));
       }
     }
     return;
@@ -714,63 +714,67 @@ void AGG::getSymConfigProb(int plClass, StrategyProfile &s, int ownPlClass, int
   } // end while
 }
 
-AggNumber AGG::getKSymMixedPayoff(int playerClass, vector<StrategyProfile> &s)
+AggNumber AGG::getKSymMixedPayoff(Workspace &w, int playerClass,
+                                  const vector<StrategyProfile> &s) const
 {
   AggNumber result = 0.0;
 
   for (int act = 0; act < (int)uniqueActionSets[playerClass].size(); act++) {
     if (s[playerClass][act] > (AggNumber)0.0) {
 
-      result += s[playerClass][act] * getKSymMixedPayoff(playerClass, act, s);
+      result += s[playerClass][act] * getKSymMixedPayoff(w, playerClass, act, s);
     }
   }
   return result;
 }
 
-AggNumber AGG::getKSymMixedPayoff(int playerClass, StrategyProfile &s)
+AggNumber AGG::getKSymMixedPayoff(Workspace &w, int playerClass, const StrategyProfile &s) const
 {
   AggNumber result = 0.0;
 
   for (int act = 0; act < (int)uniqueActionSets[playerClass].size(); act++) {
     if (s[firstKSymAction(playerClass) + act] > (AggNumber)0.0) {
 
-      result += s[firstKSymAction(playerClass) + act] * getKSymMixedPayoff(s, playerClass, act);
+      result +=
+          s[firstKSymAction(playerClass) + act] * getKSymMixedPayoff(w, s, playerClass, act);
     }
   }
   return result;
 }
 
-void AGG::getKSymPayoffVector(AggNumberVector &dest, int playerClass, StrategyProfile &s)
+void AGG::getKSymPayoffVector(Workspace &w, AggNumberVector &dest, int playerClass,
+                              const StrategyProfile &s) const
 {
   for (size_t act = 0; act < uniqueActionSets[playerClass].size(); ++act) {
-    dest[act] = getKSymMixedPayoff(s, playerClass, act);
+    dest[act] = getKSymMixedPayoff(w, s, playerClass, act);
   }
 }
 
-AggNumber AGG::getKSymMixedPayoff(int playerClass, int act, vector<StrategyProfile> &s)
+AggNumber AGG::getKSymMixedPayoff(Workspace &w, int playerClass, int act,
+                                  const vector<StrategyProfile> &s) const
 {
 
   int numPC = playerClasses.size();
 
   int numNei = neighbors[uniqueActionSets[playerClass][act]].size();
 
-  static aggdistrib d, temp;
+  aggdistrib &d = w.kSymDistrib, &temp = w.kSymTemp;
   d.reset();
   temp.reset();
-  getSymConfigProb(0, s[0], playerClass, act, d);
+  getSymConfigProb(w, 0, s[0], playerClass, act, d);
   for (int pc = 1; pc < numPC; pc++) {
-    getSymConfigProb(pc, s[pc], playerClass, act, temp);
+    getSymConfigProb(w, pc, s[pc], playerClass, act, temp);
     d.multiply(temp, numNei, projFunctions[uniqueActionSets[playerClass][act]]);
   }
   return d.inner_prod(payoffs[uniqueActionSets[playerClass][act]]);
 }
 
-AggNumber AGG::getKSymMixedPayoff(const StrategyProfile &s, int pClass1, int act1, int pClass2,
-                                  int act2)
+AggNumber AGG::getKSymMixedPayoff(Workspace &w, const StrategyProfile &s, int pClass1, int act1,
+                                  int pClass2, int act2) const
 {
   int numPC = playerClasses.size();
   int numNei = neighbors[uniqueActionSets[pClass1][act1]].size();
-  static aggdistrib d, temp;
+  aggdistrib &d = w.kSymDistrib, &temp = w.kSymTemp;
   if (pClass2 >= 0 && pClass1 == pClass2 && playerClasses.at(pClass1).size() <= 1) {
     return 0;
   }
@@ -782,7 +786,7 @@ AggNumber AGG::getKSymMixedPayoff(const StrategyProfile &s, int pClass1, int act
   for (int a = firstKSymAction(0); a < lastKSymAction(0); ++a) {
     s0[a] = s[a];
   }
-  getSymConfigProb(0, s0, pClass1, act1, d, pClass2, act2);
+  getSymConfigProb(w, 0, s0, pClass1, act1, d, pClass2, act2);
   for (int pc = 1; pc < numPC; pc++) {
     StrategyProfile ss(getNumKSymActions(pc), 0.0);
     // if (pc==pClass2)ss[act2]=1;
@@ -790,7 +794,7 @@ AggNumber AGG::getKSymMixedPayoff(const StrategyProfile &s, int pClass1, int act
     for (int a = 0; a < getNumKSymActions(pc); ++a) {
       ss[a] = s[a + firstKSymAction(pc)];
     }
-    getSymConfigProb(pc, ss, pClass1, act1, temp, pClass2, act2);
+    getSymConfigProb(w, pc, ss, pClass1, act1, temp, pClass2, act2);
     d.multiply(temp, numNei, projFunctions[uniqueActionSets[pClass1][act1]]);
   }
   return d.inner_prod(payoffs[uniqueActionSets[pClass1][act1]]);
@@ -854,7 +858,7 @@ void AGG::makeMAPPINGpayoff(std::istream &in, aggpayoff &pay, int numNei)
     }
 
     // insert
-    pair<trie_map<AggNumber>::iterator, bool> r = pay.insert(make_pair(key, u));
+    pair<aggpayoff::iterator, bool> r = pay.insert(make_pair(key, u));
     if (!r.second) {
       std::stringstream str;
       str << "ERROR: overwriting utility at [";
@@ -864,7 +868,7 @@ void AGG::makeMAPPINGpayoff(std::istream &in, aggpayoff &pay, int numNei)
     }
   }
   // check
-  for (auto &it : temp) {
+  for (const auto &it : temp) {
     if (pay.count(it.first) == 0) {
       std::stringstream str;
       str << "ERROR: utility at [";
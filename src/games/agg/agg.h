@@ -28,7 +28,7 @@
 #include <vector>
 #include <iterator>
 #include "proj_func.h"
-#include "trie_map.h"
+#include "config_map.h"
 
 namespace Gambit {
 
@@ -44,10 +44,10 @@ using StrategyProfile = std::vector<AggNumber>;
 using AggNumberVector = std::vector<AggNumber>;
 
 // data structure for payoff function:
-using aggpayoff = trie_map<AggNumber>;
+using aggpayoff = config_map<AggNumber>;
 
 // data struct for prob distribution over configurations:
-using aggdistrib = trie_map<AggNumber>;
+using aggdistrib = config_map<AggNumber>;
 
 // types of input formats for payoff func
 using payofftype = enum { COMPLETE, MAPPING, ADDITIVE };
@@ -65,6 +65,37 @@ public:
 
   friend class gametracer::aggame; // wrapper class for gametracer
 
+  // Scratch storage for computing expected payoffs.  The evaluation methods
+  // which take a Workspace do not modify the AGG, and so may be called
+  // concurrently on the same AGG, provided each thread has its own Workspace.
+  class Workspace {
+  public:
+    explicit Workspace(const AGG &agg);
+
+  private:
+    friend class AGG;
+    friend class gametracer::aggame;
+
+    // foreach s \in S, foreach i \in N, the projected mixed strat
+    // which is a prob distribution over the set of 'contributions'
+    std::vector<std::vector<aggdistrib>> projectedStrat;
+
+    // when computing the induced distribution via ComputeP():
+    // foreach k<= n-1,
+    // prob. distrib P_k induced by the partial strat profile of agents o_1..o_k
+
+    // when computing the partial distributions for the payoff jacobian:
+    //   foreach  j \in N,
+    //  the partial distribution induced by all agents except j.
+    std::vector<aggdistrib> Pr;
+
+    // cache of jacobian entries.
+    config_map<AggNumber> cache;
+
+    // distributions over configurations for k-symmetric payoffs
+    aggdistrib kSymDistrib, kSymTemp;
+  };
+
   // read an AGG from input stream
   static std::shared_ptr<AGG> makeAGG(std::istream &in);
 
@@ -74,7 +105,7 @@ public:
       std::vector<projtype> &projTypes, std::vector<std::vector<aggdistrib>> &projS,
       std::vector<std::vector<std::vector<config>>> &proj,
       std::vector<std::vector<projtype>> &projF, std::vector<std::vector<std::vector<int>>> &Po,
-      std::vector<aggdistrib> &P, std::vector<aggpayoff> &payoffs);
+      std::vector<aggpayoff> &payoffs);
 
   ~AGG() = default;
 
@@ -88,19 +119,40 @@ public:
   int getNumActionNodes() const { return numActionNodes; }
   int getNumFunctionNodes() const { return numPNodes; }
   int getNumKSymActions() const { return numKSymActions; }
-  int getNumKSymActions(int i) { return uniqueActionSets[i].size(); }
-  int getNumPlayerClasses() { return playerClasses.size(); }
+  int getNumKSymActions(int i) const { return uniqueActionSets[i].size(); }
+  int getNumPlayerClasses() const { return playerClasses.size(); }
   const PlayerSet &getPlayerClass(int cls) const { return playerClasses.at(cls); }
+  int getClassOfPlayer(int player) const { return player2Class.at(player); }
   int firstKSymAction(int i) const { return kSymStrategyOffset[i]; }
   int lastKSymAction(int i) const { return kSymStrategyOffset[i + 1]; }
 
-  // exp. payoff under mixed strat profile
-  AggNumber getMixedPayoff(int player, StrategyProfile &s);
-  void getPayoffVector(AggNumberVector &dest, int player, const StrategyProfile &s);
-  AggNumber getV(int player, int action, const StrategyProfile &s);
-  AggNumber getJ(int player, int action, int player2, int action2, StrategyProfile &s);
+  // exp. payoff under mixed strat profile.
+  // The overloads without a Workspace use one owned by the AGG, and so
+  // must not be called concurrently.
+  AggNumber getMixedPayoff(int player, const StrategyProfile &s)
+  {
+    return getMixedPayoff(workspace, player, s);
+  }
+  AggNumber getMixedPayoff(Workspace &w, int player, const StrategyProfile &s) const;
+  void getPayoffVector(AggNumberVector &dest, int player, const StrategyProfile &s)
+  {
+    getPayoffVector(workspace, dest, player, s);
+  }
+  void getPayoffVector(Workspace &w, AggNumberVector &dest, int player,
+                       const StrategyProfile &s) const;
+  AggNumber getV(int player, int action, const StrategyProfile &s)
+  {
+    return getV(workspace, player, action, s);
+  }
+  AggNumber getV(Workspace &w, int player, int action, const StrategyProfile &s) const;
+  AggNumber getJ(int player, int action, int player2, int action2, const StrategyProfile &s)
+  {
+    return getJ(workspace, player, action, player2, action2, s);
+  }
+  AggNumber getJ(Workspace &w, int player, int action, int player2, int action2,
+                 const StrategyProfile &s) const;
 
-  AggNumber getPurePayoff(int player, const std::vector<int> &s);
+  AggNumber getPurePayoff(int player, const std::vector<int> &s) const;
 
   bool isSymmetric() const
   {
@@ -111,15 +163,51 @@ public:
     }
     return true;
   }
-  AggNumber getSymMixedPayoff(StrategyProfile &s);
-  AggNumber getSymMixedPayoff(int actnode, StrategyProfile &s);
-  void getSymPayoffVector(AggNumberVector &dest, StrategyProfile &s);
-  AggNumber getKSymMixedPayoff(int playerClass, std::vector<StrategyProfile> &s);
-  AggNumber getKSymMixedPayoff(int playerClass, StrategyProfile &s);
-  AggNumber getKSymMixedPayoff(int playerClass, int act, std::vector<StrategyProfile> &s);
+  AggNumber getSymMixedPayoff(const StrategyProfile &s)
+  {
+    return getSymMixedPayoff(workspace, s);
+  }
+  AggNumber getSymMixedPayoff(Workspace &w, const StrategyProfile &s) const;
+  AggNumber getSymMixedPayoff(int actnode, const StrategyProfile &s)
+  {
+    return getSymMixedPayoff(workspace, actnode, s);
+  }
+  AggNumber getSymMixedPayoff(Workspace &w, int actnode, const StrategyProfile &s) const;
+  void getSymPayoffVector(AggNumberVector &dest, const StrategyProfile &s)
+  {
+    getSymPayoffVector(workspace, dest, s);
+  }
+  void getSymPayoffVector(Workspace &w, AggNumberVector &dest, const StrategyProfile &s) const;
+  AggNumber getKSymMixedPayoff(int playerClass, const std::vector<StrategyProfile> &s)
+  {
+    return getKSymMixedPayoff(workspace, playerClass, s);
+  }
+  AggNumber getKSymMixedPayoff(Workspace &w, int playerClass,
+                               const std::vector<StrategyProfile> &s) const;
+  AggNumber getKSymMixedPayoff(int playerClass, const StrategyProfile &s)
+  {
+    return getKSymMixedPayoff(workspace, playerClass, s);
+  }
+  AggNumber getKSymMixedPayoff(Workspace &w, int playerClass, const StrategyProfile &s) const;
+  AggNumber getKSymMixedPayoff(int playerClass, int act, const std::vector<StrategyProfile> &s)
+  {
+    return getKSymMixedPayoff(workspace, playerClass, act, s);
+  }
+  AggNumber getKSymMixedPayoff(Workspace &w, int playerClass, int act,
+                               const std::vector<StrategyProfile> &s) const;
   AggNumber getKSymMixedPayoff(const StrategyProfile &s, int pClass1, int act1, int pClass2 = -1,
-                               int act2 = -1);
-  void getKSymPayoffVector(AggNumberVector &dest, int playerClass, StrategyProfile &s);
+                               int act2 = -1)
+  {
+    return getKSymMixedPayoff(workspace, s, pClass1, act1, pClass2, act2);
+  }
+  AggNumber getKSymMixedPayoff(Workspace &w, const StrategyProfile &s, int pClass1, int act1,
+                               int pClass2 = -1, int act2 = -1) const;
+  void getKSymPayoffVector(AggNumberVector &dest, int playerClass, const StrategyProfile &s)
+  {
+    getKSymPayoffVector(workspace, dest, playerClass, s);
+  }
+  void getKSymPayoffVector(Workspace &w, AggNumberVector &dest, int playerClass,
+                           const StrategyProfile &s) const;
 
   AggNumberVector getExpectedConfig(StrategyProfile &s)
   {
@@ -195,10 +283,6 @@ private:
   // the 'contribution' of s_i to D^(s)
   std::vector<std::vector<std::vector<config>>> projection;
 
-  // foreach s \in S, foreach i \in N, the projected mixed strat
-  // which is a prob distribution over the set of 'contributions'
-  std::vector<std::vector<aggdistrib>> projectedStrat;
-
   // foreach s in S, i in N, the full set of projected actions.
   std::vector<std::vector<aggdistrib>> fullProjectedStrat;
 
@@ -209,24 +293,12 @@ private:
   //  in which we apply the DP algorithm
   std::vector<std::vector<std::vector<int>>> Porder;
 
-  // when computing the induced distribution via ComputeP():
-  // foreach k<= n-1,
-  // prob. distrib P_k induced by the partial strat profile of agents o_1..o_k
-
-  // when computing the partial distributions for the payoff jacobian:
-  //   foreach  j \in N,
-  //  the partial distribution induced by all agents except j.
-  std::vector<aggdistrib> Pr;
-
   // foreach s in S, whether s's neighbors are all action nodes
   std::vector<bool> isPure;
 
   // foreach s in S, j in N, the index of s in j's action set, or -1 if N/A
   std::vector<std::vector<int>> node2Action;
 
-  // cache of jacobian entries.
-  trie_map<AggNumber> cache;
-
   // the unique action sets
   std::vector<ActionSet> uniqueActionSets;
 
@@ -242,6 +314,9 @@ private:
   // strategyOffset for kSymmetric strategy profile
   std::vector<int> kSymStrategyOffset;
 
+  // scratch storage for the evaluation methods called without a Workspace
+  Workspace workspace;
+
   // input functor
   struct input {
     explicit input(std::istream &i) : in(i) {}
@@ -266,20 +341,20 @@ private:
   static void initPorder(std::vector<int> &Po, int i, int N, std::vector<aggdistrib> &projS);
 
   // private methods:
-  void computeP(int player, int act, int player2 = -1, int act2 = -1);
-  void doProjection(int Node, const StrategyProfile &s)
+  void computeP(Workspace &w, int player, int act, int player2 = -1, int act2 = -1) const;
+  void doProjection(Workspace &w, int Node, const StrategyProfile &s) const
   {
-    doProjection(Node, &(const_cast<StrategyProfile &>(s)[0]));
+    doProjection(w, Node, s.data());
   }
-  void doProjection(int Node, int player, const StrategyProfile &s)
+  void doProjection(Workspace &w, int Node, int player, const StrategyProfile &s) const
   {
-    doProjection(Node, player, &(const_cast<StrategyProfile &>(s)[firstAction(player)]));
+    doProjection(w, Node, player, s.data() + firstAction(player));
   }
-  void doProjection(int Node, AggNumber *s);
-  void doProjection(int Node, int player, AggNumber *s);
+  void doProjection(Workspace &w, int Node, const AggNumber *s) const;
+  void doProjection(Workspace &w, int Node, int player, const AggNumber *s) const;
 
-  void getSymConfigProb(int plClass, StrategyProfile &s, int ownPlClass, int act, aggdistrib &dest,
-                        int plClass2 = -1, int act2 = -1);
+  void getSymConfigProb(Workspace &w, int plClass, const StrategyProfile &s, int ownPlClass,
+                        int act, aggdistrib &dest, int plClass2 = -1, int act2 = -1) const;
 };
 
 } // namespace agg
@@ -44,6 +44,21 @@ BAGG::BAGG(int N, int S, vector<int> &numTypes, vector<ProbDist> &TDist,
       break;
     }
   }
+
+  inducedStrat = StrategyProfile(aggPtr->getNumActions(), AggNumber(0.0));
+  inducedVersion = std::vector<int>(numPlayers, 0);
+  projectedStrat = std::vector<std::vector<aggdistrib>>(numActionNodes,
+                                                        std::vector<aggdistrib>(numPlayers));
+  projectedVersion =
+      std::vector<std::vector<int>>(numActionNodes, std::vector<int>(numPlayers, -1));
+  actionValues = std::vector<AggNumberVector>(numPlayers);
+  actionComputed = std::vector<std::vector<bool>>(numPlayers);
+  actionVersion = std::vector<std::vector<int>>(numPlayers, std::vector<int>(numPlayers, -1));
+  for (int i = 0; i < numPlayers; ++i) {
+    actionValues[i] = AggNumberVector(aggPtr->getNumActions(i));
+    actionComputed[i] = std::vector<bool>(aggPtr->getNumActions(i), false);
+  }
+  Pr = std::vector<aggdistrib>(numPlayers);
 }
 
 namespace {
@@ -186,10 +201,12 @@ AggNumber BAGG::getMixedPayoff(int player, StrategyProfile &s)
 
 AggNumber BAGG::getMixedPayoff(int player, int tp, StrategyProfile &s)
 {
+  prepare(player, s);
   AggNumber res(0);
   for (size_t act = 0; act < typeActionSets[player][tp].size(); ++act) {
     if (s[act + firstAction(player, tp)] > AggNumber(0.0)) {
-      res += s[act + firstAction(player, tp)] * getV(player, tp, act, s);
+      res += s[act + firstAction(player, tp)] *
+             getActionValue(player, typeAction2ActionIndex[player][tp][act]);
     }
   }
   return res;
@@ -198,38 +215,94 @@ AggNumber BAGG::getMixedPayoff(int player, int tp, StrategyProfile &s)
 void BAGG::getPayoffVector(AggNumberVector &dest, int player, int tp, const StrategyProfile &s)
 {
   assert(player >= 0 && player < getNumPlayers() && tp >= 0 && tp < getNumTypes(player));
+  prepare(player, s);
   for (size_t act = 0; act < typeActionSets[player][tp].size(); ++act) {
-    dest[act] = getV(player, tp, act, s);
+    dest[act] = getActionValue(player, typeAction2ActionIndex[player][tp][act]);
   }
 }
 
-void BAGG::getAGGStrat(StrategyProfile &as, const StrategyProfile &s, int player, int tp,
-                       int action)
+void BAGG::getPayoffVectors(AggNumberVector &dest, int player, const StrategyProfile &s)
 {
-  for (int i = 0; i < aggPtr->getNumActions(); ++i) {
-    as[i] = AggNumber(0.0);
+  assert(player >= 0 && player < getNumPlayers());
+  prepare(player, s);
+  for (int tp = 0, i = 0; tp < numTypes[player]; ++tp) {
+    for (size_t act = 0; act < typeActionSets[player][tp].size(); ++act, ++i) {
+      dest[i] = getActionValue(player, typeAction2ActionIndex[player][tp][act]);
+    }
   }
+}
+
+AggNumber BAGG::getV(int player, int tp, int action, const StrategyProfile &s)
+{
+  prepare(player, s);
+  return getActionValue(player, typeAction2ActionIndex[player][tp][action]);
+}
 
+void BAGG::prepare(int player, const StrategyProfile &s)
+{
+  StrategyProfile induced;
   for (int pl = 0; pl < numPlayers; ++pl) {
-    if (pl != player) {
-      for (int t = 0; t < numTypes[pl]; ++t) {
-        for (size_t act = 0; act < typeActionSets[pl][t].size(); ++act) {
-          int aact = typeAction2ActionIndex[pl][t][act];
-          as[aact + aggPtr->firstAction(pl)] += indepTypeDist[pl][t] * s[act + firstAction(pl, t)];
-        }
+    if (pl == player) {
+      continue;
+    }
+    induced.assign(aggPtr->getNumActions(pl), AggNumber(0.0));
+    for (int t = 0; t < numTypes[pl]; ++t) {
+      for (size_t act = 0; act < typeActionSets[pl][t].size(); ++act) {
+        induced[typeAction2ActionIndex[pl][t][act]] +=
+            indepTypeDist[pl][t] * s[act + firstAction(pl, t)];
       }
     }
-    else {
-      int aact = typeAction2ActionIndex[player][tp][action];
-      as[aact + aggPtr->firstAction(player)] = 1;
+    auto current = inducedStrat.begin() + aggPtr->firstAction(pl);
+    if (!std::equal(induced.begin(), induced.end(), current)) {
+      std::copy(induced.begin(), induced.end(), current);
+      ++inducedVersion[pl];
+    }
+  }
+
+  for (int pl = 0; pl < numPlayers; ++pl) {
+    if (pl != player && actionVersion[player][pl] != inducedVersion[pl]) {
+      actionVersion[player] = inducedVersion;
+      std::fill(actionComputed[player].begin(), actionComputed[player].end(), false);
+      break;
     }
   }
 }
-AggNumber BAGG::getV(int player, int tp, int action, const StrategyProfile &s)
+
+const aggdistrib &BAGG::getProjectedStrat(int node, int player)
+{
+  aggdistrib &dist = projectedStrat[node][player];
+  if (projectedVersion[node][player] != inducedVersion[player]) {
+    const std::vector<AGG::config> &proj = aggPtr->getProjection(node)[player];
+    const AggNumber *s = &inducedStrat[aggPtr->firstAction(player)];
+    dist.reset();
+    for (int j = 0; j < aggPtr->getNumActions(player); ++j) {
+      if (s[j] > AggNumber(0.0)) {
+        dist += make_pair(proj[j], s[j]);
+      }
+    }
+    projectedVersion[node][player] = inducedVersion[player];
+  }
+  return dist;
+}
+
+AggNumber BAGG::getActionValue(int player, int action)
 {
-  StrategyProfile as(aggPtr->getNumActions());
-  getAGGStrat(as, s, player, tp, action);
-  return aggPtr->getV(player, typeAction2ActionIndex[player][tp][action], as);
+  if (actionComputed[player][action]) {
+    return actionValues[player][action];
+  }
+  // Convolve the projected induced strategies of the others, in the order
+  // chosen by the AGG, starting from the projection of player's own action.
+  const int node = aggPtr->getActionSet(player)[action];
+  const std::vector<projtype> &f = aggPtr->getProjFunctions(node);
+  const std::vector<int> &order = aggPtr->getPorder(player, action);
+  Pr[0].reset();
+  Pr[0].insert(make_pair(aggPtr->getProjection(node)[player][action], 1.0));
+  for (int k = 1; k < numPlayers; ++k) {
+    Pr[k].reset();
+    Pr[k].multiply(Pr[k - 1], getProjectedStrat(node, order[k]), f.size(), f);
+  }
+  actionComputed[player][action] = true;
+  return actionValues[player][action] = Pr[numPlayers - 1].inner_prod(aggPtr->getPayoffMap(node));
 }
 
 AggNumber BAGG::getPurePayoff(int player, int tp, std::vector<int> &ps)
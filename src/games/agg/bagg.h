@@ -71,6 +71,9 @@ public:
   AggNumber getMixedPayoff(int player, int tp, StrategyProfile &s);
 
   void getPayoffVector(AggNumberVector &dest, int player, int tp, const StrategyProfile &s);
+  // exp. payoffs to the actions of all of the player's types, stored from
+  // dest[0] in the order of firstAction(player, tp) + action.
+  void getPayoffVectors(AggNumberVector &dest, int player, const StrategyProfile &s);
   AggNumber getV(int player, int tp, int action, const StrategyProfile &s);
 
   AggNumber getPurePayoff(int player, int tp, std::vector<int> &s);
@@ -110,8 +113,38 @@ private:
 
   bool symmetric;
 
-  void getAGGStrat(StrategyProfile &as, const StrategyProfile &s, int player = -1, int tp = -1,
-                   int action = -1);
+  // Scratch storage and caches for the evaluation of expected payoffs.
+  // Payoffs are computed against the strategy over AGG actions induced by
+  // each player averaging the strategies of her types over the type
+  // distribution.  Each player's induced strategy carries a version number,
+  // which is advanced whenever it changes; the projections and payoffs
+  // computed from the induced strategies are kept until they go stale.
+
+  // the induced strategy of each player, indexed as the AGG's strategy profile
+  StrategyProfile inducedStrat;
+  std::vector<int> inducedVersion;
+
+  // foreach action node, foreach player, the projection of the player's
+  // induced strategy, and the version from which it was computed
+  std::vector<std::vector<aggdistrib>> projectedStrat;
+  std::vector<std::vector<int>> projectedVersion;
+
+  // foreach player, the exp. payoff to each of her AGG actions against the
+  // induced strategies of the others, whether it has been computed, and the
+  // versions of the others' induced strategies it was computed against
+  std::vector<AggNumberVector> actionValues;
+  std::vector<std::vector<bool>> actionComputed;
+  std::vector<std::vector<int>> actionVersion;
+
+  // distributions of the partial configurations, as in AGG::computeP
+  std::vector<aggdistrib> Pr;
+
+  // update the induced strategies of the players other than player from s,
+  // and discard player's action payoffs if they have gone stale
+  void prepare(int player, const StrategyProfile &s);
+  // the payoff to player's AGG action against the current induced strategies
+  AggNumber getActionValue(int player, int action);
+  const aggdistrib &getProjectedStrat(int node, int player);
   void getSymAGGStrat(StrategyProfile &as, const StrategyProfile &s);
 };
 
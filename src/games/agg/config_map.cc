@@ -1,10 +1,9 @@
 //
 // This file is part of Gambit
 // Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
-//                          Albert Xin Jiang <albertjiang@gmail.com>
 //
-// FILE: src/libagg/trie_map.cc
-// Trie with STL-like interfaces
+// FILE: src/games/agg/config_map.cc
+// Flat hash map from configurations to values
 //
 // This program is free software; you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -22,11 +21,11 @@
 //
 
 #include "agg.h"
-#include "trie_map.imp"
+#include "config_map.imp"
 
 namespace Gambit::agg {
 
-template class trie_map<AggNumber>;
-template std::ostream &operator<<(std::ostream &s, const trie_map<AggNumber> &t);
+template class config_map<AggNumber>;
+template std::ostream &operator<<(std::ostream &s, const config_map<AggNumber> &t);
 
 } // namespace Gambit::agg
@@ -0,0 +1,345 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/games/agg/config_map.h
+// Flat hash map from configurations to values
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_AGG_CONFIGMAP_H
+#define GAMBIT_AGG_CONFIGMAP_H
+
+// Mapping from vector of ints to type V.
+//
+// Keys are packed end-to-end in a single array, values are held in a
+// parallel array, and entries are located through an open-addressing hash
+// index.  reset() keeps all three arrays, so a map which is refilled
+// repeatedly (as are the distributions in an AGG::Workspace) stops
+// allocating once it has reached its working size.
+//
+// WARNING: traversal using the iterators is in the reverse order of insertion.
+// Copying a map inserts the entries in traversal order, so the copy is
+// traversed in the opposite order to the original.
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <sstream>
+#include <vector>
+#include "proj_func.h"
+
+namespace Gambit {
+
+namespace agg {
+
+// forward declarations
+
+template <class V> class config_map;
+template <class V> std::ostream &operator<<(std::ostream &s, const config_map<V> &t);
+
+template <class V> class config_map {
+public:
+  using key_type = std::vector<int>;
+  using value_type = std::pair<std::vector<int>, V>;
+  using size_type = unsigned int;
+
+  // read-only view of a key stored in the map
+  class key_view {
+  public:
+    key_view(const int *p_data, size_t p_size) : m_data(p_data), m_size(p_size) {}
+
+    size_t size() const { return m_size; }
+    const int *data() const { return m_data; }
+    const int *begin() const { return m_data; }
+    const int *end() const { return m_data + m_size; }
+    int operator[](size_t i) const { return m_data[i]; }
+
+    operator std::vector<int>() const { return std::vector<int>(begin(), end()); }
+
+    bool operator==(const std::vector<int> &v) const
+    {
+      return v.size() == m_size && std::equal(begin(), end(), v.begin());
+    }
+    bool operator!=(const std::vector<int> &v) const { return !(*this == v); }
+
+  private:
+    const int *m_data;
+    size_t m_size;
+  };
+
+  template <class Map, class Value> class basic_iterator {
+  public:
+    struct reference {
+      key_view first;
+      Value &second;
+    };
+    struct pointer {
+      reference m_ref;
+      reference *operator->() { return &m_ref; }
+    };
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = reference;
+    using difference_type = std::ptrdiff_t;
+
+    basic_iterator() = default;
+    basic_iterator(Map *p_map, size_type p_pos) : m_map(p_map), m_pos(p_pos) {}
+    template <class M, class W>
+    basic_iterator(const basic_iterator<M, W> &p_iter) : m_map(p_iter.m_map), m_pos(p_iter.m_pos)
+    {
+    }
+
+    reference operator*() const
+    {
+      return {m_map->key(m_pos - 1), m_map->m_values[m_pos - 1]};
+    }
+    pointer operator->() const { return {**this}; }
+
+    basic_iterator &operator++()
+    {
+      --m_pos;
+      return *this;
+    }
+    basic_iterator operator++(int)
+    {
+      basic_iterator old = *this;
+      --m_pos;
+      return old;
+    }
+
+    bool operator==(const basic_iterator &p_iter) const { return m_pos == p_iter.m_pos; }
+    bool operator!=(const basic_iterator &p_iter) const { return m_pos != p_iter.m_pos; }
+
+  private:
+    template <class M, class W> friend class basic_iterator;
+
+    Map *m_map{nullptr};
+    // one more than the index of the entry; the entries are visited from
+    // the most recently inserted, and zero is the end
+    size_type m_pos{0};
+  };
+
+  using iterator = basic_iterator<config_map<V>, V>;
+  using const_iterator = basic_iterator<const config_map<V>, const V>;
+
+  // friends
+  friend std::ostream &operator<< <V>(std::ostream &s, const config_map<V> &t);
+
+  // constructors
+  config_map() : m_offsets(1, 0) {}
+
+  // copy constructor
+  config_map(const config_map<V> &other);
+
+  // destructor
+  ~config_map() = default;
+
+  // assignment
+  config_map<V> &operator=(const config_map<V> &other);
+
+  // exchange contents with other, without copying
+  void swap(config_map<V> &other)
+  {
+    m_keys.swap(other.m_keys);
+    m_offsets.swap(other.m_offsets);
+    m_values.swap(other.m_values);
+    m_index.swap(other.m_index);
+  }
+
+  // true if the maps have the same entries, inserted in the same order
+  bool operator==(const config_map<V> &other) const
+  {
+    return m_values == other.m_values && m_offsets == other.m_offsets && m_keys == other.m_keys;
+  }
+  bool operator!=(const config_map<V> &other) const { return !(*this == other); }
+
+  size_type size() const { return m_values.size(); }
+  bool empty() const { return m_values.empty(); }
+  iterator begin() { return iterator(this, size()); }
+  iterator end() { return iterator(this, 0); }
+  const_iterator begin() const { return const_iterator(this, size()); }
+  const_iterator end() const { return const_iterator(this, 0); }
+
+  // insert: same interface as in STL map
+  std::pair<iterator, bool> insert(const value_type &x)
+  {
+    auto r = emplace(x.first.data(), x.first.size(), x.second);
+    return std::pair<iterator, bool>(iterator(this, r.first + 1), r.second);
+  }
+
+  template <class InputIterator> void insert(InputIterator f, InputIterator l)
+  {
+    for (InputIterator p = f; p != l; ++p) {
+      emplace(p->first.data(), p->first.size(), p->second);
+    }
+  }
+
+  // insert or add
+  config_map<V> &operator+=(const value_type &x)
+  {
+    accumulate(x.first.data(), x.first.size(), x.second);
+    return *this;
+  }
+
+  // exact matching
+  iterator find(const key_type &k)
+  {
+    return iterator(this, locate(k.data(), k.size()) + 1);
+  }
+  const_iterator find(const key_type &k) const
+  {
+    return const_iterator(this, locate(k.data(), k.size()) + 1);
+  }
+
+  // release the storage as well as the data
+  void clear()
+  {
+    std::vector<int>().swap(m_keys);
+    std::vector<size_type>(1, 0).swap(m_offsets);
+    std::vector<V>().swap(m_values);
+    std::vector<size_type>().swap(m_index);
+  }
+
+  // clear data, but keep the storage
+  void reset()
+  {
+    m_keys.clear();
+    m_offsets.resize(1);
+    m_values.clear();
+    std::fill(m_index.begin(), m_index.end(), 0);
+  }
+
+  // number of elements with key exactly k.
+  //  returns 1 or 0
+  size_type count(const key_type &k) const { return locate(k.data(), k.size()) != NOT_FOUND; }
+
+  // visit the entries in lexicographic order of their keys
+  template <class UnaryFunction> void in_order(UnaryFunction f)
+  {
+    for (size_type i : sorted_entries()) {
+      f(iterator(this, i + 1));
+    }
+  }
+
+  // polynomial multiplication of t1 and t2, store the result in self
+  void multiply(const config_map<V> &t1, const config_map<V> &t2, size_t keylen,
+                const std::vector<projtype> &f);
+
+  // multiplication of t1 by the distribution putting all weight on x,
+  // store the result in self
+  void multiply(const config_map<V> &t1, const std::vector<int> &x, size_t keylen,
+                const std::vector<projtype> &f);
+
+  // multiply in-place. other should not be the same object as self.
+  void multiply(const config_map<V> &other, size_t keylen, const std::vector<projtype> &f);
+
+  // multiply in-place by the distribution putting all weight on x
+  void multiply(const std::vector<int> &x, size_t keylen, const std::vector<projtype> &f);
+
+  // squaring
+  void square(config_map<V> &dest, size_t keylen, const std::vector<projtype> &f) const;
+
+  void power(size_t p, config_map<V> &dest, config_map<V> &scratch, size_t keylen,
+             const std::vector<projtype> &f) const;
+
+  // inner product
+  V inner_prod(const config_map<V> &other, V init = (V)(0)) const;
+
+  // first apply the action x, then inner prod
+  V inner_prod(const std::vector<int> &x, size_t keylen, const std::vector<projtype> &f,
+               const config_map<V> &other, V init = (V)(0)) const;
+
+  // polynomial division
+  config_map<V> &operator/=(const std::vector<V> &denom);
+
+private:
+  // member variables:
+  // the keys, stored end-to-end; entry i occupies [m_offsets[i], m_offsets[i+1])
+  std::vector<int> m_keys;
+  std::vector<size_type> m_offsets;
+  std::vector<V> m_values;
+  // open-addressing hash index: each slot is zero, or one more than the
+  // index of an entry.  The size is zero or a power of two.
+  std::vector<size_type> m_index;
+
+  // storage for the previous contents during in-place operations
+  std::vector<int> m_oldKeys;
+  std::vector<size_type> m_oldOffsets;
+  std::vector<V> m_oldValues;
+  // scratch key for building configurations
+  std::vector<int> m_conf;
+
+  static const double THRESH;
+  static const size_type NOT_FOUND = static_cast<size_type>(-1);
+
+  // private methods:
+  key_view key(size_type i) const
+  {
+    return key_view(m_keys.data() + m_offsets[i], m_offsets[i + 1] - m_offsets[i]);
+  }
+
+  static size_t hash(const int *k, size_t n)
+  {
+    size_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < n; ++i) {
+      h = (h ^ static_cast<unsigned int>(k[i])) * 1099511628211ULL;
+    }
+    return h ^ (h >> 32);
+  }
+
+  bool matches(size_type i, const int *k, size_t n) const
+  {
+    return m_offsets[i + 1] - m_offsets[i] == n &&
+           std::equal(k, k + n, m_keys.begin() + m_offsets[i]);
+  }
+
+  // the index of the entry with key k, or NOT_FOUND
+  size_type locate(const int *k, size_t n) const;
+
+  // the index of the entry with key k, inserting one with value v if there
+  // is none; the second member is true if the entry was inserted
+  std::pair<size_type, bool> emplace(const int *k, size_t n, const V &v);
+
+  // add v to the value at key k, inserting the entry if there is none
+  void accumulate(const int *k, size_t n, const V &v)
+  {
+    auto r = emplace(k, n, v);
+    if (!r.second) {
+      m_values[r.first] += v;
+    }
+  }
+
+  void rebuild_index(size_type slots);
+
+  // move the contents into the m_old* arrays, leaving the map empty
+  void save_contents();
+
+  // the indices of the entries, in lexicographic order of their keys
+  std::vector<size_type> sorted_entries() const;
+
+  // helper for operator/=(): add y to the entry with key conf
+  void div_add(const std::vector<int> &conf, V y, V pivot);
+};
+
+template <class V> const double config_map<V>::THRESH = 1e-12;
+
+template <class V> std::ostream &operator<<(std::ostream &s, const config_map<V> &t);
+
+} // namespace agg
+
+} // end namespace Gambit
+
+#endif // GAMBIT_AGG_CONFIGMAP_H
@@ -433,6 +433,9 @@ public:
   /// Returns true if the game has a action-graph game representation
   virtual bool IsAgg() const { return false; }
 
+  /// Returns true if the game has a Bayesian action-graph game representation
+  virtual bool IsBagg() const { return false; }
+
   /// Get the text label associated with the game
   virtual const std::string &GetTitle() const { return m_title; }
   /// Set the text label associated with the game
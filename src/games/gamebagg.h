@@ -121,7 +121,7 @@ public:
   /// @name General data access
   //@{
   bool IsTree() const override { return false; }
-  virtual bool IsBagg() const { return true; }
+  bool IsBagg() const override { return true; }
   bool IsPerfectRecall(GameInfoset &, GameInfoset &) const override { return true; }
   bool IsConstSum() const override { throw UndefinedException(); }
   /// Returns the smallest payoff in any outcome of the game
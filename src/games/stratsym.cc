@@ -0,0 +1,264 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/games/stratsym.cc
+// Compressed payoff representation of symmetric strategic games
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include "gambit.h"
+#include "stratsym.h"
+
+namespace Gambit {
+
+//========================================================================
+//                     class SymmetricPayoffTable<T>
+//========================================================================
+
+template <class T>
+SymmetricPayoffTable<T>::SymmetricPayoffTable(const Game &p_game)
+  : m_game(p_game), m_numPlayers(p_game->NumPlayers()),
+    m_numStrategies(p_game->GetPlayer(1)->NumStrategies())
+{
+  const int m = m_numStrategies;
+  for (auto player : m_game->GetPlayers()) {
+    if (static_cast<int>(player->NumStrategies()) != m) {
+      throw UndefinedException(
+          "The game is not symmetric: players have different numbers of strategies");
+    }
+  }
+
+  m_binomial.assign((m_numPlayers + m - 1) * m, 0);
+  for (int n = 0; n < m_numPlayers + m - 1; n++) {
+    m_binomial[n * m] = 1;
+    for (int k = 1; k < m && n > 0; k++) {
+      m_binomial[n * m + k] = m_binomial[(n - 1) * m + k - 1] + m_binomial[(n - 1) * m + k];
+    }
+  }
+  Enumerate(m_numPlayers - 1, m_configs, m_multiplicity);
+  Enumerate(m_numPlayers - 2, m_subConfigs, m_subMultiplicity);
+  m_successors.resize(m_subMultiplicity.size() * m);
+  for (size_t c = 0; c < m_subMultiplicity.size(); c++) {
+    std::vector<int> counts(&m_subConfigs[c * m], &m_subConfigs[c * m] + m);
+    for (int st = 0; st < m; st++) {
+      counts[st]++;
+      m_successors[c * m + st] = Rank(counts.data());
+      counts[st]--;
+    }
+  }
+
+  // Visit each contingency, keeping track of the number of players choosing
+  // each strategy.  Each player's payoff is checked against the payoff
+  // recorded for the same strategy and configuration of the others.
+  const size_t numConfigs = NumConfigurations();
+  std::vector<Rational> payoffs(m * numConfigs);
+  std::vector<bool> filled(m * numConfigs, false);
+  PureStrategyProfile profile = m_game->NewPureStrategyProfile();
+  std::vector<int> current(m_numPlayers, 0), counts(m, 0);
+  counts[0] = m_numPlayers;
+  for (int pl = 1; pl <= m_numPlayers; pl++) {
+    profile->SetStrategy(m_game->GetPlayer(pl)->GetStrategy(1));
+  }
+  while (true) {
+    for (int pl = 0; pl < m_numPlayers; pl++) {
+      const int st = current[pl];
+      counts[st]--;
+      const size_t index = st * numConfigs + Rank(counts.data());
+      counts[st]++;
+      Rational payoff = profile->GetPayoff(pl + 1);
+      if (!filled[index]) {
+        payoffs[index] = payoff;
+        filled[index] = true;
+      }
+      else if (payoffs[index] != payoff) {
+        throw UndefinedException("The game is not symmetric");
+      }
+    }
+    int pl = 0;
+    for (; pl < m_numPlayers; pl++) {
+      counts[current[pl]]--;
+      if (++current[pl] < m) {
+        counts[current[pl]]++;
+        profile->SetStrategy(m_game->GetPlayer(pl + 1)->GetStrategy(current[pl] + 1));
+        break;
+      }
+      current[pl] = 0;
+      counts[0]++;
+      profile->SetStrategy(m_game->GetPlayer(pl + 1)->GetStrategy(1));
+    }
+    if (pl == m_numPlayers) {
+      break;
+    }
+  }
+  m_payoffs.resize(payoffs.size());
+  std::transform(payoffs.cbegin(), payoffs.cend(), m_payoffs.begin(),
+                 [](const Rational &x) { return static_cast<T>(x); });
+}
+
+template <class T> bool SymmetricPayoffTable<T>::IsSymmetric(const Game &p_game)
+{
+  try {
+    SymmetricPayoffTable<Rational> table(p_game);
+    return true;
+  }
+  catch (UndefinedException &) {
+    return false;
+  }
+}
+
+template <class T> size_t SymmetricPayoffTable<T>::Rank(const int *p_counts) const
+{
+  // The configuration is encoded by the positions of the m-1 bars separating
+  // the counts in a row of stars and bars; the rank is that of this set of
+  // positions in the combinatorial number system.
+  const int m = m_numStrategies;
+  size_t rank = 0;
+  for (int i = 0, bar = -1; i < m - 1; i++) {
+    bar += p_counts[i] + 1;
+    rank += m_binomial[bar * m + i + 1];
+  }
+  return rank;
+}
+
+template <class T>
+void SymmetricPayoffTable<T>::Enumerate(int p_count, std::vector<int> &p_configs,
+                                        std::vector<T> &p_multiplicity) const
+{
+  const int m = m_numStrategies;
+  if (p_count < 0) {
+    return;
+  }
+  const size_t total = m_binomial[(p_count + m - 1) * m + m - 1];
+  p_configs.resize(total * m);
+  p_multiplicity.resize(total);
+
+  std::vector<std::vector<T>> pascal(p_count + 1);
+  for (int n = 0; n <= p_count; n++) {
+    pascal[n].resize(n + 1, static_cast<T>(1));
+    for (int k = 1; k < n; k++) {
+      pascal[n][k] = pascal[n - 1][k - 1] + pascal[n - 1][k];
+    }
+  }
+
+  std::vector<int> counts(m, 0);
+  counts[0] = p_count;
+  while (true) {
+    const size_t index = Rank(counts.data());
+    std::copy(counts.cbegin(), counts.cend(), &p_configs[index * m]);
+    T multiplicity(static_cast<T>(1));
+    for (int st = 0, sum = 0; st < m; st++) {
+      sum += counts[st];
+      multiplicity *= pascal[sum][counts[st]];
+    }
+    p_multiplicity[index] = multiplicity;
+
+    // Advance to the next configuration, moving one player from the last
+    // strategy before the final one which is chosen by anyone
+    int st = m - 2;
+    while (st >= 0 && counts[st] == 0) {
+      st--;
+    }
+    if (st < 0) {
+      break;
+    }
+    counts[st]--;
+    const int last = counts[m - 1];
+    counts[m - 1] = 0;
+    counts[st + 1] = last + 1;
+  }
+}
+
+template <class T>
+void SymmetricPayoffTable<T>::GetProbabilities(const std::vector<int> &p_configs,
+                                               const std::vector<T> &p_multiplicity,
+                                               const T *p_probs, int p_count,
+                                               std::vector<T> &p_result) const
+{
+  const int m = m_numStrategies;
+  std::vector<T> powers(m * (p_count + 1));
+  for (int st = 0; st < m; st++) {
+    T *row = &powers[st * (p_count + 1)];
+    row[0] = static_cast<T>(1);
+    for (int e = 1; e <= p_count; e++) {
+      row[e] = row[e - 1] * p_probs[st];
+    }
+  }
+  p_result.resize(p_multiplicity.size());
+  for (size_t c = 0; c < p_multiplicity.size(); c++) {
+    const int *config = &p_configs[c * m];
+    T prob = p_multiplicity[c];
+    for (int st = 0; st < m; st++) {
+      prob *= powers[st * (p_count + 1) + config[st]];
+    }
+    p_result[c] = prob;
+  }
+}
+
+template <class T>
+void SymmetricPayoffTable<T>::GetStrategyValues(const Vector<T> &p_probs,
+                                                Vector<T> &p_values) const
+{
+  std::vector<T> probs;
+  GetProbabilities(m_configs, m_multiplicity, &p_probs.front(), m_numPlayers - 1, probs);
+  const size_t numConfigs = NumConfigurations();
+  T *values = &p_values.front();
+  for (int st = 0; st < m_numStrategies; st++) {
+    const T *payoffs = &m_payoffs[st * numConfigs];
+    T value(static_cast<T>(0));
+    for (size_t c = 0; c < numConfigs; c++) {
+      value += probs[c] * payoffs[c];
+    }
+    values[st] = value;
+  }
+}
+
+template <class T>
+void SymmetricPayoffTable<T>::GetPayoffDerivs(const Vector<T> &p_probs, Vector<T> &p_values,
+                                              std::vector<T> &p_derivs) const
+{
+  const int m = m_numStrategies;
+  GetStrategyValues(p_probs, p_values);
+  p_derivs.resize(m * m);
+  std::fill(p_derivs.begin(), p_derivs.end(), static_cast<T>(0));
+  if (m_numPlayers < 2) {
+    return;
+  }
+
+  std::vector<T> probs;
+  GetProbabilities(m_subConfigs, m_subMultiplicity, &p_probs.front(), m_numPlayers - 2, probs);
+  const size_t numConfigs = NumConfigurations();
+  for (size_t c = 0; c < probs.size(); c++) {
+    const size_t *successors = &m_successors[c * m];
+    for (int st = 0; st < m; st++) {
+      const T *payoffs = &m_payoffs[st * numConfigs];
+      T *derivs = &p_derivs[st * m];
+      for (int st2 = 0; st2 < m; st2++) {
+        derivs[st2] += probs[c] * payoffs[successors[st2]];
+      }
+    }
+  }
+  const T others(static_cast<T>(m_numPlayers - 1));
+  for (auto &deriv : p_derivs) {
+    deriv *= others;
+  }
+}
+
+template class SymmetricPayoffTable<double>;
+template class SymmetricPayoffTable<long double>;
+template class SymmetricPayoffTable<Rational>;
+
+} // end namespace Gambit
@@ -0,0 +1,143 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/games/stratsym.h
+// Compressed payoff representation of symmetric strategic games
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_GAMES_STRATSYM_H
+#define GAMBIT_GAMES_STRATSYM_H
+
+#include "gambit.h"
+
+namespace Gambit {
+
+/// @brief The payoffs of a symmetric strategic game, stored once per configuration
+///
+/// A strategic game is symmetric if all players have the same number of
+/// strategies, and permuting the players permutes their payoffs in the
+/// same way.  The payoff to a player then depends only on the player's own
+/// strategy and on how many of the other players choose each strategy,
+/// that is, on the configuration of the others.  With N players each having
+/// m strategies there are C(N+m-2, m-1) configurations of the N-1 others,
+/// so the table stores m * C(N+m-2, m-1) payoffs in place of N * m^N.
+///
+/// Configurations are indexed by the colexicographic rank of their
+/// stars-and-bars encoding.  Strategies are indexed from zero.
+///
+/// Only symmetric profiles, in which every player adopts the same mixed
+/// strategy, are evaluated; these are the profiles at which the symmetric
+/// equilibria of the game are found.
+///
+/// The table is not updated if the game is subsequently modified.
+template <class T> class SymmetricPayoffTable {
+private:
+  Game m_game;
+  int m_numPlayers, m_numStrategies;
+  /// Binomial coefficients C(n, k) at index n * m_numStrategies + k, used for ranking
+  std::vector<size_t> m_binomial;
+  /// Configurations of the other players, m_numStrategies counts apiece,
+  /// and the number of assignments of strategies to players which give each
+  std::vector<int> m_configs;
+  std::vector<T> m_multiplicity;
+  /// The same for the configurations of all players but two, together with the
+  /// index of the configuration obtained by adding one player choosing each strategy
+  std::vector<int> m_subConfigs;
+  std::vector<T> m_subMultiplicity;
+  std::vector<size_t> m_successors;
+  /// Payoff to strategy st against configuration c is at index st * NumConfigurations() + c
+  std::vector<T> m_payoffs;
+
+  /// Returns the rank of the configuration among those with the same number of players
+  size_t Rank(const int *p_counts) const;
+  /// Lists the configurations of p_count players, in order of rank
+  void Enumerate(int p_count, std::vector<int> &p_configs, std::vector<T> &p_multiplicity) const;
+  /// Computes the probability of each configuration when every player uses p_probs
+  void GetProbabilities(const std::vector<int> &p_configs, const std::vector<T> &p_multiplicity,
+                        const T *p_probs, int p_count, std::vector<T> &p_result) const;
+
+public:
+  /// @name Lifecycle
+  //@{
+  /// Tabulates the payoffs of the game
+  /// @exception UndefinedException  If the game is not symmetric
+  explicit SymmetricPayoffTable(const Game &p_game);
+  //@}
+
+  /// Returns true if the game is symmetric.  This requires visiting every
+  /// pure strategy contingency of the game.
+  static bool IsSymmetric(const Game &p_game);
+
+  /// @name General data access
+  //@{
+  const Game &GetGame() const { return m_game; }
+  int NumPlayers() const { return m_numPlayers; }
+  /// Returns the number of strategies of each player
+  int NumStrategies() const { return m_numStrategies; }
+  /// Returns the number of configurations of the strategies of the other players
+  size_t NumConfigurations() const { return m_multiplicity.size(); }
+  /// Returns the index of the configuration in which p_counts[st] of the
+  /// other players choose strategy st
+  size_t GetConfiguration(const std::vector<int> &p_counts) const
+  {
+    return Rank(p_counts.data());
+  }
+  /// Returns the payoff to a player choosing strategy p_strategy (indexed from
+  /// zero) when the others are in configuration p_config
+  const T &GetPayoff(int p_strategy, size_t p_config) const
+  {
+    return m_payoffs[p_strategy * NumConfigurations() + p_config];
+  }
+  //@}
+
+  /// @name Evaluation against symmetric profiles
+  //@{
+  /// @brief Computes the value of each strategy when all other players use p_probs
+  /// @param[in] p_probs  The probability of each strategy, indexed from one
+  /// @param[out] p_values  The expected payoff to each strategy
+  void GetStrategyValues(const Vector<T> &p_probs, Vector<T> &p_values) const;
+
+  /// @brief Computes strategy values and their derivatives
+  /// @details In addition to the strategy values, fills the square block of
+  ///          derivatives, stored by rows in p_derivs, such that the entry
+  ///          (s, t) is the derivative of the value of strategy s with respect
+  ///          to the probability of strategy t, when that probability changes
+  ///          for all the other players together.  This is N-1 times the value
+  ///          of s when one other player chooses t.
+  void GetPayoffDerivs(const Vector<T> &p_probs, Vector<T> &p_values,
+                       std::vector<T> &p_derivs) const;
+  //@}
+};
+
+/// Returns the profile on the game in which every player adopts the mixed
+/// strategy p_probs, which is indexed from one in the order of the strategies
+template <class T>
+MixedStrategyProfile<T> SymmetricProfile(const Game &p_game, const Vector<T> &p_probs)
+{
+  MixedStrategyProfile<T> profile = p_game->NewMixedStrategyProfile(static_cast<T>(0));
+  for (auto player : p_game->GetPlayers()) {
+    for (size_t st = 1; st <= player->GetStrategies().size(); st++) {
+      profile[player->GetStrategies()[st]] = p_probs[st];
+    }
+  }
+  return profile;
+}
+
+} // end namespace Gambit
+
+#endif // GAMBIT_GAMES_STRATSYM_H
@@ -0,0 +1,229 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/games/strattensor.cc
+// Dense tabulation of the payoffs of a strategic game
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include "gambit.h"
+#include "strattensor.h"
+
+namespace Gambit {
+
+//========================================================================
+//                     class StrategicPayoffTensor<T>
+//========================================================================
+
+template <class T>
+StrategicPayoffTensor<T>::StrategicPayoffTensor(const Game &p_game)
+  : m_game(p_game), m_numPlayers(p_game->NumPlayers()), m_numContingencies(1),
+    m_profileLength(0), m_numStrategies(m_numPlayers), m_firstStrategy(m_numPlayers)
+{
+  for (int pl = 0; pl < m_numPlayers; pl++) {
+    m_numStrategies[pl] = m_game->GetPlayer(pl + 1)->NumStrategies();
+    m_firstStrategy[pl] = m_profileLength;
+    m_profileLength += m_numStrategies[pl];
+    m_numContingencies *= m_numStrategies[pl];
+  }
+
+  m_payoffs.resize(m_numContingencies * m_numPlayers);
+  PureStrategyProfile profile = m_game->NewPureStrategyProfile();
+  std::vector<int> current(m_numPlayers, 1);
+  for (int pl = 1; pl <= m_numPlayers; pl++) {
+    profile->SetStrategy(m_game->GetPlayer(pl)->GetStrategy(1));
+  }
+  for (size_t index = 0; index < m_numContingencies; index++) {
+    for (int pl = 1; pl <= m_numPlayers; pl++) {
+      m_payoffs[index * m_numPlayers + pl - 1] = static_cast<T>(profile->GetPayoff(pl));
+    }
+    for (int pl = 0; pl < m_numPlayers; pl++) {
+      if (current[pl] < m_numStrategies[pl]) {
+        profile->SetStrategy(m_game->GetPlayer(pl + 1)->GetStrategy(++current[pl]));
+        break;
+      }
+      current[pl] = 1;
+      profile->SetStrategy(m_game->GetPlayer(pl + 1)->GetStrategy(1));
+    }
+  }
+}
+
+template <class T>
+void StrategicPayoffTensor<T>::GetStrategyValues(const Vector<T> &p_probs,
+                                                 Vector<T> &p_values) const
+{
+  const T *probs = &p_probs.front();
+  T *values = &p_values.front();
+  std::fill(values, values + m_profileLength, static_cast<T>(0));
+
+  // The strategy of each player at the current contingency, and the products
+  // of the probabilities of the strategies of the players before and after
+  std::vector<int> current(m_firstStrategy);
+  std::vector<T> prefix(m_numPlayers + 1), suffix(m_numPlayers + 1);
+  prefix[0] = static_cast<T>(1);
+  suffix[m_numPlayers] = static_cast<T>(1);
+  for (int pl = m_numPlayers - 1; pl >= 0; pl--) {
+    suffix[pl] = probs[current[pl]] * suffix[pl + 1];
+  }
+
+  const T *payoffs = m_payoffs.data();
+  for (size_t index = 0; index < m_numContingencies; index++, payoffs += m_numPlayers) {
+    for (int pl = 0; pl < m_numPlayers; pl++) {
+      values[current[pl]] += payoffs[pl] * prefix[pl] * suffix[pl + 1];
+      prefix[pl + 1] = prefix[pl] * probs[current[pl]];
+    }
+    // Advance to the next contingency, and refresh the suffix products of
+    // the players whose strategies changed
+    int changed = 0;
+    for (; changed < m_numPlayers; changed++) {
+      if (++current[changed] < m_firstStrategy[changed] + m_numStrategies[changed]) {
+        break;
+      }
+      current[changed] = m_firstStrategy[changed];
+    }
+    for (int pl = std::min(changed, m_numPlayers - 1); pl >= 0; pl--) {
+      suffix[pl] = probs[current[pl]] * suffix[pl + 1];
+    }
+  }
+}
+
+template <class T>
+void StrategicPayoffTensor<T>::GetPayoffDerivs(const Vector<T> &p_probs, Vector<T> &p_values,
+                                               std::vector<T> &p_derivs) const
+{
+  const T *probs = &p_probs.front();
+  T *values = &p_values.front();
+  std::fill(values, values + m_profileLength, static_cast<T>(0));
+  p_derivs.resize(m_profileLength * m_profileLength);
+  std::fill(p_derivs.begin(), p_derivs.end(), static_cast<T>(0));
+  T *derivs = p_derivs.data();
+
+  std::vector<int> current(m_firstStrategy);
+  std::vector<T> prefix(m_numPlayers + 1), suffix(m_numPlayers + 1);
+  prefix[0] = static_cast<T>(1);
+  suffix[m_numPlayers] = static_cast<T>(1);
+  for (int pl = m_numPlayers - 1; pl >= 0; pl--) {
+    suffix[pl] = probs[current[pl]] * suffix[pl + 1];
+  }
+
+  const T *payoffs = m_payoffs.data();
+  for (size_t index = 0; index < m_numContingencies; index++, payoffs += m_numPlayers) {
+    for (int pl = 0; pl < m_numPlayers; pl++) {
+      const int st = current[pl];
+      values[st] += payoffs[pl] * prefix[pl] * suffix[pl + 1];
+      // The weight of the contingency for the pair (pl, pl2) is the product of
+      // the probabilities of all other players' strategies; this accumulates
+      // the product over the players strictly between the two.
+      T between = static_cast<T>(1);
+      for (int pl2 = pl + 1; pl2 < m_numPlayers; pl2++) {
+        const int st2 = current[pl2];
+        const T weight = prefix[pl] * between * suffix[pl2 + 1];
+        derivs[st * m_profileLength + st2] += payoffs[pl] * weight;
+        derivs[st2 * m_profileLength + st] += payoffs[pl2] * weight;
+        between *= probs[st2];
+      }
+      prefix[pl + 1] = prefix[pl] * probs[st];
+    }
+    int changed = 0;
+    for (; changed < m_numPlayers; changed++) {
+      if (++current[changed] < m_firstStrategy[changed] + m_numStrategies[changed]) {
+        break;
+      }
+      current[changed] = m_firstStrategy[changed];
+    }
+    for (int pl = std::min(changed, m_numPlayers - 1); pl >= 0; pl--) {
+      suffix[pl] = probs[current[pl]] * suffix[pl + 1];
+    }
+  }
+}
+
+template <class T>
+void StrategicPayoffTensor<T>::UpdateStrategyValues(const Vector<T> &p_probs, int p_player,
+                                                    const std::vector<T> &p_change,
+                                                    Vector<T> &p_values) const
+{
+  const T *probs = &p_probs.front();
+  T *values = &p_values.front();
+  std::vector<size_t> stride(m_numPlayers);
+  for (size_t pl = 0, size = 1; pl < stride.size(); size *= m_numStrategies[pl], pl++) {
+    stride[pl] = size;
+  }
+  // Contingencies in which a third player chooses a strategy with probability
+  // zero contribute nothing, so only the supports of the players are visited
+  std::vector<std::vector<int>> support(m_numPlayers);
+  for (int pl = 0; pl < m_numPlayers; pl++) {
+    for (int st = 0; st < m_numStrategies[pl]; st++) {
+      if (probs[m_firstStrategy[pl] + st] != static_cast<T>(0)) {
+        support[pl].push_back(st);
+      }
+    }
+  }
+
+  std::vector<int> others;
+  std::vector<size_t> current(m_numPlayers);
+  for (int pl = 0; pl < m_numPlayers; pl++) {
+    if (pl == p_player) {
+      continue;
+    }
+    others.clear();
+    for (int pl2 = 0; pl2 < m_numPlayers; pl2++) {
+      if (pl2 != p_player && pl2 != pl) {
+        others.push_back(pl2);
+      }
+    }
+    if (std::any_of(others.cbegin(), others.cend(),
+                    [&support](int pl2) { return support[pl2].empty(); })) {
+      continue;
+    }
+    T *plValues = values + m_firstStrategy[pl];
+    for (int st = 0; st < m_numStrategies[p_player]; st++) {
+      if (p_change[st] == static_cast<T>(0)) {
+        continue;
+      }
+      std::fill(current.begin(), current.end(), 0);
+      while (true) {
+        size_t index = st * stride[p_player];
+        T weight = p_change[st];
+        for (int pl2 : others) {
+          const int st2 = support[pl2][current[pl2]];
+          index += st2 * stride[pl2];
+          weight *= probs[m_firstStrategy[pl2] + st2];
+        }
+        const T *payoffs = &m_payoffs[index * m_numPlayers + pl];
+        for (int st2 = 0; st2 < m_numStrategies[pl]; st2++) {
+          plValues[st2] += payoffs[st2 * stride[pl] * m_numPlayers] * weight;
+        }
+        auto pl2 = others.cbegin();
+        for (; pl2 != others.cend(); ++pl2) {
+          if (++current[*pl2] < support[*pl2].size()) {
+            break;
+          }
+          current[*pl2] = 0;
+        }
+        if (pl2 == others.cend()) {
+          break;
+        }
+      }
+    }
+  }
+}
+
+template class StrategicPayoffTensor<double>;
+template class StrategicPayoffTensor<long double>;
+template class StrategicPayoffTensor<Rational>;
+
+} // end namespace Gambit
@@ -0,0 +1,120 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/games/strattensor.h
+// Dense tabulation of the payoffs of a strategic game
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_GAMES_STRATTENSOR_H
+#define GAMBIT_GAMES_STRATTENSOR_H
+
+#include "gambit.h"
+
+namespace Gambit {
+
+/// @brief A dense tabulation of the payoffs of a strategic game
+///
+/// The payoffs of every player at every pure strategy contingency are
+/// copied into one flat array, with the first player's strategy varying
+/// fastest.  Strategies are indexed from zero, in the same order as the
+/// entries of a mixed strategy profile on the full support of the game.
+///
+/// This permits computing all quantities derived from a mixed strategy
+/// profile which a solver needs at a point (the value of each strategy,
+/// and the derivatives of those values with respect to the probabilities
+/// of other players' strategies) in a single pass over the table, rather
+/// than in one traversal per quantity.
+///
+/// The tensor is not updated if the game is subsequently modified.
+template <class T> class StrategicPayoffTensor {
+private:
+  Game m_game;
+  int m_numPlayers;
+  size_t m_numContingencies, m_profileLength;
+  /// Number of strategies for each player
+  std::vector<int> m_numStrategies;
+  /// Index of the first strategy of each player in the flattened profile
+  std::vector<int> m_firstStrategy;
+  /// Payoff to player pl at contingency c is at index c * m_numPlayers + pl
+  std::vector<T> m_payoffs;
+
+public:
+  /// @name Lifecycle
+  //@{
+  /// Tabulates the payoffs of the game
+  explicit StrategicPayoffTensor(const Game &p_game);
+  //@}
+
+  /// Returns true if the game is represented explicitly as a table, so
+  /// tabulating it requires no more storage than the game itself
+  static bool IsTabulated(const Game &p_game)
+  {
+    return !p_game->IsTree() && !p_game->IsAgg() && !p_game->IsBagg();
+  }
+
+  /// @name General data access
+  //@{
+  const Game &GetGame() const { return m_game; }
+  int NumPlayers() const { return m_numPlayers; }
+  /// Returns the number of strategies of player pl (indexed from zero)
+  int NumStrategies(int pl) const { return m_numStrategies[pl]; }
+  /// Returns the index of the first strategy of player pl (indexed from zero)
+  int FirstStrategy(int pl) const { return m_firstStrategy[pl]; }
+  /// Returns the total number of strategies in the game
+  size_t MixedProfileLength() const { return m_profileLength; }
+  /// Returns the number of pure strategy contingencies in the game
+  size_t NumContingencies() const { return m_numContingencies; }
+  /// Returns the payoffs to all players at contingency p_index
+  const T *GetPayoffs(size_t p_index) const { return &m_payoffs[p_index * m_numPlayers]; }
+  //@}
+
+  /// @name Evaluation against mixed strategy profiles
+  //@{
+  /// @brief Computes the value of each strategy against the profile
+  /// @param[in] p_probs  The probability of each strategy, as indexed in a
+  ///                     mixed strategy profile (from one)
+  /// @param[out] p_values  The expected payoff to each strategy, against the
+  ///                       strategies of the other players in the profile
+  void GetStrategyValues(const Vector<T> &p_probs, Vector<T> &p_values) const;
+
+  /// @brief Computes strategy values and their cross-player derivatives
+  /// @details In addition to the strategy values, fills the square block of
+  ///          derivatives, stored by rows in p_derivs, such that the entry
+  ///          (s, t) is the derivative of the value of strategy s with respect
+  ///          to the probability of strategy t.  Entries for pairs of
+  ///          strategies of the same player are zero.
+  void GetPayoffDerivs(const Vector<T> &p_probs, Vector<T> &p_values,
+                       std::vector<T> &p_derivs) const;
+
+  /// @brief Updates strategy values for a change in one player's strategy
+  /// @details Given the values p_values of the strategies against p_probs,
+  ///          updates them to the values after the probability of strategy st
+  ///          of player p_player (both indexed from zero) increases by
+  ///          p_change[st].  As values are linear in each player's strategy,
+  ///          only the contingencies in which p_player chooses a strategy whose
+  ///          probability changes, and the other players all but one choose
+  ///          strategies with positive probability, are visited.  The values of
+  ///          p_player's own strategies do not change.
+  void UpdateStrategyValues(const Vector<T> &p_probs, int p_player,
+                            const std::vector<T> &p_change, Vector<T> &p_values) const;
+  //@}
+};
+
+} // end namespace Gambit
+
+#endif // GAMBIT_GAMES_STRATTENSOR_H
@@ -20,8 +20,12 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include <chrono>
+#include <map>
+#include <mutex>
 #include <numeric>
 #include "gambit.h"
+#include "core/parallel.h"
 #include "solvers/gnm/gnm.h"
 #include "solvers/gtracer/gtracer.h"
 
@@ -30,10 +34,20 @@ using namespace Gambit::gametracer;
 
 namespace {
 
+void CheckPerturbation(const cvector &p_pert)
+{
+  bool nonzero = std::accumulate(p_pert.cbegin(), p_pert.cend(), false,
+                                 [](bool accum, double value) { return accum || value != 0.0; });
+  if (!nonzero) {
+    throw UndefinedException("Perturbation vector must have at least one nonzero component.");
+  }
+}
+
 List<MixedStrategyProfile<double>>
 Solve(const Game &p_game, const std::shared_ptr<gnmgame> &p_rep, const cvector &p_pert,
       double p_lambdaEnd, int p_steps, int p_localNewtonInterval, int p_localNewtonMaxits,
-      std::function<void(const MixedStrategyProfile<double> &, const std::string &)> &p_callback)
+      std::function<void(const MixedStrategyProfile<double> &, const std::string &)> &p_callback,
+      bool p_symmetric = false)
 {
   const double FUZZ = 1e-12;
   const bool WOBBLE = false;
@@ -42,28 +56,171 @@ Solve(const Game &p_game, const std::shared_ptr<gnmgame> &p_rep, const cvector &
   if (p_lambdaEnd >= 0.0) {
     throw std::out_of_range("Value of lambdaEnd must be negative");
   }
-  bool nonzero = std::accumulate(p_pert.cbegin(), p_pert.cend(), false,
-                                 [](bool accum, double value) { return accum || value != 0.0; });
-  if (!nonzero) {
-    throw UndefinedException("Perturbation vector must have at least one nonzero component.");
-  }
+  CheckPerturbation(p_pert);
+  // In symmetric mode, vectors have one block of strategies per player class
+  auto to_profile = [p_game, p_rep, p_symmetric](const cvector &p_vector) {
+    return (p_symmetric) ? ToKSymProfile(p_game, *p_rep, p_vector) : ToProfile(p_game, p_vector);
+  };
   List<MixedStrategyProfile<double>> eqa;
-  p_callback(ToProfile(p_game, p_pert), "pert");
+  p_callback(to_profile(p_pert), "pert");
   cvector norm_pert = p_pert / p_pert.norm();
   std::list<cvector> answers;
   std::string return_message;
-  auto callback = [p_game, p_callback](const std::string &label, const cvector &sigma) {
-    p_callback(ToProfile(p_game, sigma), label);
+  auto callback = [to_profile, p_callback](const std::string &label, const cvector &sigma) {
+    p_callback(to_profile(sigma), label);
   };
   GNM(*p_rep, norm_pert, answers, p_steps, FUZZ, p_localNewtonInterval, p_localNewtonMaxits,
-      p_lambdaEnd, WOBBLE, THRESHOLD, callback, return_message);
+      p_lambdaEnd, WOBBLE, THRESHOLD, callback, return_message, p_symmetric);
   for (auto answer : answers) {
-    eqa.push_back(ToProfile(p_game, answer));
+    eqa.push_back(to_profile(answer));
     p_callback(eqa.back(), "NE");
   }
   return eqa;
 }
 
+//
+// The distinct equilibria found along a number of paths.  Equilibria are
+// bucketed by a weighted sum of their components, with positive weights
+// summing to one.  The sums for two profiles which are within the tolerance
+// of each other in every component are themselves within the tolerance, and
+// so lie in the same or adjacent buckets, which are the only ones searched.
+//
+class EquilibriumIndex {
+public:
+  explicit EquilibriumIndex(double p_tolerance) : m_tolerance(p_tolerance) {}
+
+  // Adds the profile, unless it is within the tolerance of one already
+  // present in every component.  Returns true if the profile is added.
+  bool Insert(const cvector &p_profile)
+  {
+    const long bucket = GetBucket(p_profile);
+    for (auto entry = m_buckets.lower_bound(bucket - 1);
+         entry != m_buckets.end() && entry->first <= bucket + 1; ++entry) {
+      const cvector &other = m_profiles[entry->second];
+      bool close = true;
+      for (int i = 0; close && i < p_profile.getm(); i++) {
+        close = std::abs(p_profile[i] - other[i]) <= m_tolerance;
+      }
+      if (close) {
+        return false;
+      }
+    }
+    m_buckets.emplace(bucket, m_profiles.size());
+    m_profiles.push_back(p_profile);
+    return true;
+  }
+
+private:
+  double m_tolerance;
+  std::vector<cvector> m_profiles;
+  std::multimap<long, size_t> m_buckets;
+
+  long GetBucket(const cvector &p_profile) const
+  {
+    const int m = p_profile.getm();
+    double sum = 0.0;
+    for (int i = 0; i < m; i++) {
+      sum += (i + 1) * p_profile[i];
+    }
+    return static_cast<long>(std::floor(2.0 * sum / (m * (m + 1.0)) / m_tolerance));
+  }
+};
+
+// Thrown from the step callback to abandon a path once the search is over
+class PathInterrupted : public std::exception {
+public:
+  const char *what() const noexcept override { return "Path interrupted"; }
+};
+
+List<MixedStrategyProfile<double>>
+SolveRays(const Game &p_game, const std::shared_ptr<gnmgame> &p_rep,
+          const std::vector<cvector> &p_perts, double p_lambdaEnd, int p_steps,
+          int p_localNewtonInterval, int p_localNewtonMaxits, int p_threads,
+          int p_maxEquilibria, double p_maxSeconds, double p_tolerance,
+          Nash::StrategyCallbackType &p_callback, bool p_symmetric)
+{
+  const double FUZZ = 1e-12;
+  const bool WOBBLE = false;
+  const double THRESHOLD = 1e-2;
+
+  if (p_lambdaEnd >= 0.0) {
+    throw std::out_of_range("Value of lambdaEnd must be negative");
+  }
+  if (p_tolerance <= 0.0) {
+    throw std::out_of_range("Tolerance for distinct equilibria must be positive");
+  }
+  for (const auto &pert : p_perts) {
+    CheckPerturbation(pert);
+  }
+  if (p_threads < 1) {
+    p_threads = DefaultThreadCount();
+  }
+  if (auto agg = std::dynamic_pointer_cast<aggame>(p_rep); agg && p_threads > 1) {
+    // The threads are better spent on following separate paths than on
+    // sharing out the computation of each Jacobian.
+    agg->setNumThreads(1);
+  }
+
+  auto to_profile = [p_game, p_rep, p_symmetric](const cvector &p_vector) {
+    return (p_symmetric) ? ToKSymProfile(p_game, *p_rep, p_vector) : ToProfile(p_game, p_vector);
+  };
+  const auto start = std::chrono::steady_clock::now();
+  auto out_of_time = [start, p_maxSeconds]() {
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return p_maxSeconds > 0.0 && elapsed.count() >= p_maxSeconds;
+  };
+
+  // Output, the index of equilibria found, and the equilibria themselves are
+  // shared among the paths, and guarded by the mutex.
+  std::mutex mutex;
+  std::atomic<bool> done(false);
+  EquilibriumIndex index(p_tolerance);
+  List<MixedStrategyProfile<double>> eqa;
+
+  ParallelFor(p_perts.size(), p_threads, [&](int ray) {
+    if (done || out_of_time()) {
+      done = true;
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      p_callback(to_profile(p_perts[ray]), "pert");
+    }
+    cvector norm_pert = p_perts[ray] / p_perts[ray].norm();
+    std::list<cvector> answers;
+    std::string return_message;
+    auto callback = [&](const std::string &label, const cvector &sigma) {
+      if (done || out_of_time()) {
+        done = true;
+        throw PathInterrupted();
+      }
+      std::lock_guard<std::mutex> lock(mutex);
+      p_callback(to_profile(sigma), label);
+    };
+    try {
+      GNM(*p_rep, norm_pert, answers, p_steps, FUZZ, p_localNewtonInterval, p_localNewtonMaxits,
+          p_lambdaEnd, WOBBLE, THRESHOLD, callback, return_message, p_symmetric);
+    }
+    catch (PathInterrupted &) {
+      // Equilibria found before the interruption are kept
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto &answer : answers) {
+      if (p_maxEquilibria > 0 && eqa.size() >= static_cast<size_t>(p_maxEquilibria)) {
+        break;
+      }
+      if (index.Insert(answer)) {
+        eqa.push_back(to_profile(answer));
+        p_callback(eqa.back(), "NE");
+      }
+    }
+    if (p_maxEquilibria > 0 && eqa.size() >= static_cast<size_t>(p_maxEquilibria)) {
+      done = true;
+    }
+  });
+  return eqa;
+}
+
 } // namespace
 
 namespace Gambit {
@@ -105,5 +262,44 @@ List<MixedStrategyProfile<double>> GNMStrategySolve(const MixedStrategyProfile<d
                p_localNewtonInterval, p_localNewtonMaxits, p_callback);
 }
 
+List<MixedStrategyProfile<double>>
+GNMSymmetricStrategySolve(const MixedStrategyProfile<double> &p_pert, double p_lambdaEnd,
+                          int p_steps, int p_localNewtonInterval, int p_localNewtonMaxits,
+                          StrategyCallbackType p_callback)
+{
+  if (!p_pert.GetGame()->IsPerfectRecall()) {
+    throw UndefinedException(
+        "Computing equilibria of games with imperfect recall is not supported.");
+  }
+  std::shared_ptr<gnmgame> A = BuildSymmetricGame(p_pert.GetGame(), true);
+  return Solve(p_pert.GetGame(), A, ToKSymPerturbation(*A, p_pert), p_lambdaEnd, p_steps,
+               p_localNewtonInterval, p_localNewtonMaxits, p_callback, true);
+}
+
+List<MixedStrategyProfile<double>>
+GNMStrategySolve(const List<MixedStrategyProfile<double>> &p_perts, double p_lambdaEnd,
+                 int p_steps, int p_localNewtonInterval, int p_localNewtonMaxits, int p_threads,
+                 int p_maxEquilibria, double p_maxSeconds, double p_tolerance, bool p_symmetric,
+                 StrategyCallbackType p_callback)
+{
+  if (p_perts.empty()) {
+    return {};
+  }
+  const Game game = p_perts.front().GetGame();
+  if (!game->IsPerfectRecall()) {
+    throw UndefinedException(
+        "Computing equilibria of games with imperfect recall is not supported.");
+  }
+  std::shared_ptr<gnmgame> A =
+      (p_symmetric) ? BuildSymmetricGame(game, true) : BuildGame(game, true);
+  std::vector<cvector> perts;
+  for (const auto &pert : p_perts) {
+    perts.push_back((p_symmetric) ? ToKSymPerturbation(*A, pert) : ToPerturbation(pert));
+  }
+  return SolveRays(game, A, perts, p_lambdaEnd, p_steps, p_localNewtonInterval,
+                   p_localNewtonMaxits, p_threads, p_maxEquilibria, p_maxSeconds, p_tolerance,
+                   p_callback, p_symmetric);
+}
+
 } // namespace Nash
 } // end namespace Gambit
@@ -33,6 +33,7 @@ const double GNM_LAMBDA_END_DEFAULT = -10.0;
 const int GNM_LOCAL_NEWTON_INTERVAL_DEFAULT = 3;
 const int GNM_LOCAL_NEWTON_MAXITS_DEFAULT = 10;
 const int GNM_STEPS_DEFAULT = 100;
+const double GNM_EQUILIBRIUM_TOLERANCE_DEFAULT = 1.0e-6;
 
 List<MixedStrategyProfile<double>>
 GNMStrategySolve(const Game &p_game, double p_lambdaEnd, int p_steps, int p_localNewtonInterval,
@@ -45,6 +46,39 @@ GNMStrategySolve(const MixedStrategyProfile<double> &p_profile, double p_lambdaE
                  int p_localNewtonInterval, int p_localNewtonMaxits,
                  StrategyCallbackType p_callback = NullStrategyCallback);
 
+/// @brief Compute the symmetric mixed strategy equilibria accessible via the initial ray
+///        determined by \p p_profile using the Global Newton method
+/// @details The path is followed in the space of symmetric profiles, so each step
+///          works with the strategies of one player.  For action graph games, the
+///          equilibria computed are k-symmetric: players with the same set of actions
+///          play the same strategy.  The perturbation of each such class of players
+///          is that of its first player in \p p_profile.
+/// @exception UndefinedException  If the game is not symmetric, and is not an action
+///                                graph game
+List<MixedStrategyProfile<double>>
+GNMSymmetricStrategySolve(const MixedStrategyProfile<double> &p_profile, double p_lambdaEnd,
+                          int p_steps, int p_localNewtonInterval, int p_localNewtonMaxits,
+                          StrategyCallbackType p_callback = NullStrategyCallback);
+
+/// @brief Compute the mixed strategy equilibria accessible via several initial rays,
+///        following the rays concurrently
+/// @details Each ray is determined by one of \p p_perts, as for a single ray.  Up to
+///          \p p_threads rays are followed at once, all sharing one representation of the
+///          game; if \p p_threads is less than one, the number of hardware threads is used.
+///          An equilibrium is reported only if it differs by more than \p p_tolerance in
+///          some component from every equilibrium already reported.  Once
+///          \p p_maxEquilibria distinct equilibria have been found, or \p p_maxSeconds have
+///          elapsed, no further rays are started, and those in progress are abandoned at
+///          their next support boundary.  Limits which are not positive are not applied.
+///          If \p p_symmetric is set, symmetric equilibria are computed as by
+///          GNMSymmetricStrategySolve.
+List<MixedStrategyProfile<double>>
+GNMStrategySolve(const List<MixedStrategyProfile<double>> &p_perts, double p_lambdaEnd,
+                 int p_steps, int p_localNewtonInterval, int p_localNewtonMaxits, int p_threads,
+                 int p_maxEquilibria, double p_maxSeconds,
+                 double p_tolerance = GNM_EQUILIBRIUM_TOLERANCE_DEFAULT, bool p_symmetric = false,
+                 StrategyCallbackType p_callback = NullStrategyCallback);
+
 } // namespace Nash
 } // end namespace Gambit
 
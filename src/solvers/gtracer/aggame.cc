@@ -21,12 +21,74 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include "core/parallel.h"
 #include "aggame.h"
 
 namespace Gambit {
 namespace gametracer {
 
-void aggame::computePartialP_PureNode(int player1, int act1, std::vector<int> &tasks) const
+aggame::aggame(const Gambit::GameAGGRep &g)
+  : gnmgame(g.GetUnderlyingAGG()->actions), aggPtr(g.GetUnderlyingAGG()),
+    jacobianCache(aggPtr->numActionNodes)
+{
+  for (int player = 0; player < aggPtr->numPlayers; player++) {
+    for (int act = 0; act < aggPtr->actions[player]; act++) {
+      jacobianCache[aggPtr->actionSets[player][act]].rows.emplace_back(player, act);
+    }
+  }
+  for (auto &node : jacobianCache) {
+    node.projectedStrat.resize(aggPtr->numPlayers);
+  }
+}
+
+void aggame::NodeJacobian::saveRows(const cmatrix &dest, const aggame &game)
+{
+  const int width = game.getNumActions();
+  values.resize(rows.size() * width);
+  auto value = values.begin();
+  for (auto [player, act] : rows) {
+    for (int col = 0; col < width; col++) {
+      *value++ = dest(game.firstAction(player) + act, col);
+    }
+  }
+}
+
+void aggame::NodeJacobian::copyRows(cmatrix &dest, const aggame &game) const
+{
+  // the block for the row player's own actions holds the fuzz, which is
+  // set on each call
+  const int width = game.getNumActions();
+  auto value = values.begin();
+  for (auto [player, act] : rows) {
+    double *row = &dest(game.firstAction(player) + act, 0);
+    std::copy(value, value + game.firstAction(player), row);
+    std::copy(value + game.lastAction(player), value + width, row + game.lastAction(player));
+    value += width;
+  }
+}
+
+aggame::WorkspaceLease::WorkspaceLease(const aggame &p_game) : m_game(p_game)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_game.workspaceMutex);
+    if (!m_game.workspacePool.empty()) {
+      m_workspace = std::move(m_game.workspacePool.back());
+      m_game.workspacePool.pop_back();
+    }
+  }
+  if (!m_workspace) {
+    m_workspace = std::make_unique<agg::AGG::Workspace>(*m_game.aggPtr);
+  }
+}
+
+aggame::WorkspaceLease::~WorkspaceLease()
+{
+  std::lock_guard<std::mutex> lock(m_game.workspaceMutex);
+  m_game.workspacePool.push_back(std::move(m_workspace));
+}
+
+void aggame::computePartialP_PureNode(agg::AGG::Workspace &w, int player1, int act1,
+                                      std::vector<int> &tasks) const
 {
   int i, j, Node = aggPtr->actionSets[player1][act1];
   int numNei = aggPtr->neighbors[Node].size();
@@ -35,21 +97,21 @@ void aggame::computePartialP_PureNode(int player1, int act1, std::vector<int> &t
   std::vector<agg::AggNumber> strat(numNei);
   agg::AGG::config a(numNei, 0);
   // compute the full distrib
-  aggPtr->computeP(player1, act1);
+  aggPtr->computeP(w, player1, act1);
 
   // store the full distrib in Pr[player1]
-  aggPtr->Pr[player1].swap(aggPtr->Pr[numPlayers - 1]);
+  w.Pr[player1] = w.Pr[numPlayers - 1];
   for (i = 0; i < (int)tasks.size(); i++) {
     // assert(tasks[i]!=player1);
-    agg::aggdistrib &P = aggPtr->Pr[tasks[i]];
+    agg::aggdistrib &P = w.Pr[tasks[i]];
     // P.clear();  // to get ready for division, we need clear()
-    P = aggPtr->Pr[player1];
+    P = w.Pr[player1];
 
     bool NullOnly = true;
     for (j = 0; j < numNei; ++j) {
       a[j]++;
-      auto pp = aggPtr->projectedStrat[Node][tasks[i]].find(a);
-      if (pp == aggPtr->projectedStrat[Node][tasks[i]].end()) {
+      auto pp = w.projectedStrat[Node][tasks[i]].find(a);
+      if (pp == w.projectedStrat[Node][tasks[i]].end()) {
         strat[j] = 0;
       }
       else {
@@ -78,7 +140,8 @@ void aggame::computePartialP_PureNode(int player1, int act1, std::vector<int> &t
   } // end for(i
 }
 
-void aggame::computePartialP_bisect(int player1, int act1, std::vector<int>::iterator start,
+void aggame::computePartialP_bisect(agg::AGG::Workspace &w, int player1, int act1,
+                                    std::vector<int>::iterator start,
                                     std::vector<int>::iterator endp, agg::aggdistrib &temp) const
 {
 #ifdef AGGDEBUG
@@ -87,7 +150,7 @@ void aggame::computePartialP_bisect(int player1, int act1, std::vector<int>::ite
        << endl;
 #endif
   if (endp - start == 1) {
-    aggPtr->Pr[*start].reset();
+    w.Pr[*start].reset();
     return;
   }
   int Node = aggPtr->actionSets[player1][act1];
@@ -98,41 +161,41 @@ void aggame::computePartialP_bisect(int player1, int act1, std::vector<int>::ite
 #ifdef AGGDEBUG
   cout << "*mid=" << *mid << " mid-start=" << mid - start << " endp-mid=" << endp - mid << endl;
 #endif
-  computePartialP_bisect(player1, act1, start, mid, temp);
-  computePartialP_bisect(player1, act1, mid, endp, temp);
+  computePartialP_bisect(w, player1, act1, start, mid, temp);
+  computePartialP_bisect(w, player1, act1, mid, endp, temp);
 
   temp.reset();
-  temp = aggPtr->projectedStrat[Node][*start];
+  temp = w.projectedStrat[Node][*start];
   if (mid - start > 1) {
-    temp.multiply(aggPtr->Pr[*start], numNei, aggPtr->projFunctions[Node]);
+    temp.multiply(w.Pr[*start], numNei, aggPtr->projFunctions[Node]);
   }
 
   if (mid - start == 1) {
-    // assert(aggPtr->Pr[*start].empty());
-    aggPtr->Pr[*start] = aggPtr->projectedStrat[Node][*mid];
+    // assert(w.Pr[*start].empty());
+    w.Pr[*start] = w.projectedStrat[Node][*mid];
     if (endp - mid > 1) {
-      aggPtr->Pr[*start].multiply(aggPtr->Pr[*mid], numNei, aggPtr->projFunctions[Node]);
+      w.Pr[*start].multiply(w.Pr[*mid], numNei, aggPtr->projFunctions[Node]);
     }
   }
   else {
     for (ptr = start; ptr != mid; ++ptr) {
       player2 = *ptr;
-      aggPtr->Pr[player2].multiply(aggPtr->projectedStrat[Node][*mid], numNei,
+      w.Pr[player2].multiply(w.projectedStrat[Node][*mid], numNei,
                                    aggPtr->projFunctions[Node]);
       if (endp - mid > 1) {
-        aggPtr->Pr[player2].multiply(aggPtr->Pr[*mid], numNei, aggPtr->projFunctions[Node]);
+        w.Pr[player2].multiply(w.Pr[*mid], numNei, aggPtr->projFunctions[Node]);
       }
     }
   }
 
   if (endp - mid == 1) {
-    // assert(aggPtr->Pr[*mid].empty());
-    aggPtr->Pr[*mid] = temp;
+    // assert(w.Pr[*mid].empty());
+    w.Pr[*mid] = temp;
   }
   else {
     for (ptr = mid; ptr != endp; ++ptr) {
       player2 = *ptr;
-      aggPtr->Pr[player2].multiply(temp, numNei, aggPtr->projFunctions[Node]);
+      w.Pr[player2].multiply(temp, numNei, aggPtr->projFunctions[Node]);
     }
   }
 }
@@ -145,190 +208,212 @@ void aggame::payoffMatrix(cmatrix &dest, const cvector &s, agg::AggNumber fuzz)
 #ifdef AGGDEBUG
   cout << "calling payoffMatrix with stratety s=" << endl << s << endl;
 #endif
-  agg::AggNumber fuzzcount;
-  int rown, coln, rowi, coli, act1, act2, currNode, numNei;
-  static std::vector<int>::iterator p;
-  static std::vector<int> tasks, spares, nontasks;
-  tasks.reserve(aggPtr->numPlayers);
-  spares.reserve(aggPtr->numPlayers);
-  nontasks.reserve(aggPtr->numPlayers);
-  aggPtr->cache.reset();
-
-  // do projection
-  for (int Node = 0; Node < aggPtr->numActionNodes; Node++) {
-    aggPtr->doProjection(Node, s.values());
-  }
-
   // deal with the diagonal
-  for (rown = 0; rown < aggPtr->numPlayers; ++rown) {
-    fuzzcount = fuzz;
-    for (rowi = firstAction(rown); rowi < lastAction(rown); rowi++) {
-      for (coli = firstAction(rown); coli < lastAction(rown); coli++) {
+  for (int rown = 0; rown < aggPtr->numPlayers; ++rown) {
+    agg::AggNumber fuzzcount = fuzz;
+    for (int rowi = firstAction(rown); rowi < lastAction(rown); rowi++) {
+      for (int coli = firstAction(rown); coli < lastAction(rown); coli++) {
         dest(rowi, coli) = fuzzcount;
         fuzzcount += fuzz;
       }
     }
   }
-  for (rown = 0; rown < aggPtr->numPlayers; ++rown) {      // rown: the row player
-    for (act1 = 0; act1 < aggPtr->actions[rown]; act1++) { // act1: player rown's action
 
-      currNode = aggPtr->actionSets[rown][act1];
-      numNei = aggPtr->neighbors[currNode].size();
+  // The rows for the actions at different action nodes share no
+  // intermediate results, so the nodes are shared out among threads.
+  ParallelFor(aggPtr->numActionNodes, numThreads, [this, &dest, &s](int node) {
+    WorkspaceLease lease(*this);
+    computeNodeRows(*lease, dest, node, s);
+  });
+}
+
+void aggame::computeNodeRows(agg::AGG::Workspace &w, cmatrix &dest, int currNode,
+                             const cvector &s) const
+{
+  NodeJacobian &cached = jacobianCache[currNode];
+  std::lock_guard<std::mutex> lock(cached.mutex);
+
+  // do projection
+  bool changed = !cached.valid;
+  for (int i = 0; i < aggPtr->numPlayers; i++) {
+    aggPtr->doProjection(w, currNode, i, s.values() + firstAction(i));
+    changed = changed || w.projectedStrat[currNode][i] != cached.projectedStrat[i];
+  }
+  if (!changed) {
+    cached.copyRows(dest, *this);
+    return;
+  }
+
+  int coln, act2;
+  int numNei = aggPtr->neighbors[currNode].size();
+  std::vector<int>::iterator p;
+  std::vector<int> tasks, spares, nontasks;
+  tasks.reserve(aggPtr->numPlayers);
+  spares.reserve(aggPtr->numPlayers);
+  nontasks.reserve(aggPtr->numPlayers);
+  w.cache.reset();
+
+  for (auto [rown, act1] : cached.rows) { // rown: the row player, act1: rown's action
 #ifdef AGGDEBUG
-      cout << "for player " << rown << ", action " << act1 << ", action node " << currNode << endl;
-      cout << "cache is: " << endl << aggPtr->cache << endl;
+    cout << "for player " << rown << ", action " << act1 << ", action node " << currNode << endl;
+    cout << "cache is: " << endl << w.cache << endl;
 #endif
-      tasks.clear(); // for these col players, we need to compute the distribution induced by their
-                     // complements. input of the bisection alg
-      spares.clear();   // these col players have only one projected action
-      nontasks.clear(); // complement of tasks. includes spares, and completely cached col players
+    tasks.clear(); // for these col players, we need to compute the distribution induced by their
+                   // complements. input of the bisection alg
+    spares.clear();   // these col players have only one projected action
+    nontasks.clear(); // complement of tasks. includes spares, and completely cached col players
 
-      std::vector<int> key(numNei + 3);
-      key[numNei] = rown;
-      key[numNei + 1] = act1;
+    std::vector<int> key(numNei + 3);
+    key[numNei] = rown;
+    key[numNei + 1] = act1;
 
-      // first, populate tasks, spares and nontasks
-      for (coln = 0; coln < aggPtr->numPlayers; ++coln) {
-        if (rown != coln) { // coln: col player
+    // first, populate tasks, spares and nontasks
+    for (coln = 0; coln < aggPtr->numPlayers; ++coln) {
+      if (rown != coln) { // coln: col player
 
-          key[numNei + 2] = coln;
-          bool allCached = true;
-          for (act2 = 0; act2 < aggPtr->actions[coln]; ++act2) {
+        key[numNei + 2] = coln;
+        bool allCached = true;
+        for (act2 = 0; act2 < aggPtr->actions[coln]; ++act2) {
 
-            copy(aggPtr->projection[currNode][coln][act2].begin(),
-                 aggPtr->projection[currNode][coln][act2].end(), key.begin());
+          copy(aggPtr->projection[currNode][coln][act2].begin(),
+               aggPtr->projection[currNode][coln][act2].end(), key.begin());
 #ifdef AGGDEBUG
-            cout << "for player2=" << coln << " act2=" << act2 << endl;
-            cout << "checking cache for: [";
-            copy(key.begin(), key.end(), ostream_iterator<int>(cout, " "));
-            cout << "]\n";
+          cout << "for player2=" << coln << " act2=" << act2 << endl;
+          cout << "checking cache for: [";
+          copy(key.begin(), key.end(), ostream_iterator<int>(cout, " "));
+          cout << "]\n";
 #endif
-            auto r = aggPtr->cache.findExact(key);
-            if (r != aggPtr->cache.end()) {
-              dest(act1 + firstAction(rown), act2 + firstAction(coln)) = r->second;
-            }
-            else {
-              allCached = false;
-            }
+          auto r = w.cache.find(key);
+          if (r != w.cache.end()) {
+            dest(act1 + firstAction(rown), act2 + firstAction(coln)) = r->second;
+          }
+          else {
+            allCached = false;
           }
-          if (allCached) { // if all coln's actions are already cached:
+        }
+        if (allCached) { // if all coln's actions are already cached:
+          nontasks.push_back(coln);
+        }
+        else {
+          if (aggPtr->fullProjectedStrat[currNode][coln].size() ==
+              1) { // if coln has only one projected action
+            spares.push_back(coln);
             nontasks.push_back(coln);
           }
           else {
-            if (aggPtr->fullProjectedStrat[currNode][coln].size() ==
-                1) { // if coln has only one projected action
-              spares.push_back(coln);
-              nontasks.push_back(coln);
-            }
-            else {
-              tasks.push_back(coln);
-            }
+            tasks.push_back(coln);
           }
         }
       }
+    }
 #ifdef AGGDEBUG
-      cout << "spares are: [";
-      copy(spares.begin(), spares.end(), ostream_iterator<int>(cout, " "));
-      cout << "]\ntasks are :[";
-      copy(tasks.begin(), tasks.end(), ostream_iterator<int>(cout, " "));
-      cout << "]\n";
+    cout << "spares are: [";
+    copy(spares.begin(), spares.end(), ostream_iterator<int>(cout, " "));
+    cout << "]\ntasks are :[";
+    copy(tasks.begin(), tasks.end(), ostream_iterator<int>(cout, " "));
+    cout << "]\n";
 #endif
 
-      // compute partial prob distributions
-      if (tasks.empty() && spares.empty()) {
-        continue;
-      } // nothing to be done for this row
+    // compute partial prob distributions
+    if (tasks.empty() && spares.empty()) {
+      continue;
+    } // nothing to be done for this row
 
-      if (aggPtr->isPure[currNode] || tasks.empty()) {
-        computePartialP_PureNode(rown, act1, tasks);
-      }
-      else { // do bisection
-        computePartialP_bisect(rown, act1, tasks.begin(), tasks.end(), aggPtr->Pr[rown]);
+    if (aggPtr->isPure[currNode] || tasks.empty()) {
+      computePartialP_PureNode(w, rown, act1, tasks);
+    }
+    else { // do bisection
+      computePartialP_bisect(w, rown, act1, tasks.begin(), tasks.end(), w.Pr[rown]);
 #ifdef AGGDEBUG
-        cout << "after calling computePartialP_bisect:" << endl;
-        for (int tt = 0; tt < tasks.size(); tt++) {
-          cout << "for player " << tasks[tt] << endl;
-          cout << aggPtr->Pr[tasks[tt]] << endl;
-        }
+      cout << "after calling computePartialP_bisect:" << endl;
+      for (int tt = 0; tt < tasks.size(); tt++) {
+        cout << "for player " << tasks[tt] << endl;
+        cout << w.Pr[tasks[tt]] << endl;
+      }
 #endif
-        // now apply rown's action (act1), and the strategies of
-        // players in nontasks
-        aggPtr->Pr[rown].reset();
-        aggPtr->Pr[rown].insert(make_pair(aggPtr->projection[currNode][rown][act1], 1.0));
-        for (p = nontasks.begin(); p != nontasks.end(); ++p) {
-          aggPtr->Pr[rown].multiply(aggPtr->projectedStrat[currNode][*p], numNei,
-                                    aggPtr->projFunctions[currNode]);
-        }
+      // now apply rown's action (act1), and the strategies of
+      // players in nontasks
+      w.Pr[rown].reset();
+      w.Pr[rown].insert(make_pair(aggPtr->projection[currNode][rown][act1], 1.0));
+      for (p = nontasks.begin(); p != nontasks.end(); ++p) {
+        w.Pr[rown].multiply(w.projectedStrat[currNode][*p], numNei,
+                                  aggPtr->projFunctions[currNode]);
+      }
 #ifdef AGGDEBUG
-        cout << "the polynomial product of strats of player " << rown
-             << " and players in the vector nontasks is:" << endl;
-        cout << aggPtr->Pr[rown] << endl;
+      cout << "the polynomial product of strats of player " << rown
+           << " and players in the vector nontasks is:" << endl;
+      cout << w.Pr[rown] << endl;
 #endif
-        if (tasks.size() == 1) {
-          aggPtr->Pr[tasks[0]] = aggPtr->Pr[rown];
-        }
-        else {
-          for (p = tasks.begin(); p != tasks.end(); ++p) {
-            if (aggPtr->Pr[*p].empty()) {
-              std::cerr << "AGG::payoffMatrix() ERROR for rown=" << rown << " act1=" << act1
-                        << " *p=" << *p << ": the distribution should not be empty!" << std::endl;
+      if (tasks.size() == 1) {
+        w.Pr[tasks[0]] = w.Pr[rown];
+      }
+      else {
+        for (p = tasks.begin(); p != tasks.end(); ++p) {
+          if (w.Pr[*p].empty()) {
+            std::cerr << "AGG::payoffMatrix() ERROR for rown=" << rown << " act1=" << act1
+                      << " *p=" << *p << ": the distribution should not be empty!" << std::endl;
 #ifdef AGGDEBUG
-              std::cerr << "strategy profile is: " << s << std::endl;
+            std::cerr << "strategy profile is: " << s << std::endl;
 #endif
-            }
-            aggPtr->Pr[*p].multiply(aggPtr->Pr[rown], numNei, aggPtr->projFunctions[currNode]);
-          } // end for(p=tasks.begin...
-        }
+          }
+          w.Pr[*p].multiply(w.Pr[rown], numNei, aggPtr->projFunctions[currNode]);
+        } // end for(p=tasks.begin...
+      }
 
-        // if spares not empty, we need to compute nondisturbed payoffs
-        // which requires the distrib induced by everyone (except rown).
-        // we store this distrib in Pr[rown][act1][rown]
-        if (!spares.empty()) {
-          // assert(tasks.size()>0);
-          aggPtr->Pr[rown].reset();
-          aggPtr->Pr[rown].multiply(aggPtr->Pr[tasks[0]],
-                                    aggPtr->projectedStrat[currNode][tasks[0]], numNei,
-                                    aggPtr->projFunctions[currNode]);
-        }
-      } // end else
-#ifdef AGGDEBUG
-      cout << "after computing parital distributions, the distributions are" << endl;
-      for (int tt = 0; tt < numPlayers; tt++) {
-        cout << "for player " << tt << endl;
-        cout << aggPtr->Pr[tt];
-        cout << endl;
+      // if spares not empty, we need to compute nondisturbed payoffs
+      // which requires the distrib induced by everyone (except rown).
+      // we store this distrib in Pr[rown][act1][rown]
+      if (!spares.empty()) {
+        // assert(tasks.size()>0);
+        w.Pr[rown].reset();
+        w.Pr[rown].multiply(w.Pr[tasks[0]],
+                                  w.projectedStrat[currNode][tasks[0]], numNei,
+                                  aggPtr->projFunctions[currNode]);
       }
+    } // end else
+#ifdef AGGDEBUG
+    cout << "after computing parital distributions, the distributions are" << endl;
+    for (int tt = 0; tt < numPlayers; tt++) {
+      cout << "for player " << tt << endl;
+      cout << w.Pr[tt];
+      cout << endl;
+    }
 #endif
-      // compute entries
-      agg::AggNumber undisturbedPayoff;
-      bool hasUndisturbed = false;
-
-      if (!spares.empty()) { // for players in spares, we compute one undisturbed payoff
-        computeUndisturbedPayoff(undisturbedPayoff, hasUndisturbed, rown, act1, rown);
-        for (p = spares.begin(); p != spares.end(); ++p) {
-          for (act2 = 0; act2 < aggPtr->actions[*p]; act2++) {
-            savePayoff(dest, rown, act1, *p, act2, undisturbedPayoff, aggPtr->cache);
-          }
+    // compute entries
+    agg::AggNumber undisturbedPayoff;
+    bool hasUndisturbed = false;
+
+    if (!spares.empty()) { // for players in spares, we compute one undisturbed payoff
+      computeUndisturbedPayoff(w, undisturbedPayoff, hasUndisturbed, rown, act1, rown);
+      for (p = spares.begin(); p != spares.end(); ++p) {
+        for (act2 = 0; act2 < aggPtr->actions[*p]; act2++) {
+          savePayoff(dest, rown, act1, *p, act2, undisturbedPayoff, w.cache);
         }
       }
-      for (p = tasks.begin(); p != tasks.end(); ++p) {
-        for (act2 = 0; act2 < aggPtr->actions[*p]; act2++) { // act2: col action
-
-          if (aggPtr->projectedStrat[currNode][*p].size() == 1 &&
-              aggPtr->projectedStrat[currNode][*p].begin()->first ==
-                  aggPtr->projection[currNode][*p][act2]) {
-            computeUndisturbedPayoff(undisturbedPayoff, hasUndisturbed, rown, act1, *p);
-            savePayoff(dest, rown, act1, *p, act2, undisturbedPayoff, aggPtr->cache);
-          }
-          computePayoff(dest, rown, act1, *p, act2, aggPtr->cache);
-        } // end for(act2
-      }   // end for(p
-    }     // end for(act1
-  }       // end for(rown
+    }
+    for (p = tasks.begin(); p != tasks.end(); ++p) {
+      for (act2 = 0; act2 < aggPtr->actions[*p]; act2++) { // act2: col action
+
+        if (w.projectedStrat[currNode][*p].size() == 1 &&
+            w.projectedStrat[currNode][*p].begin()->first ==
+                aggPtr->projection[currNode][*p][act2]) {
+          computeUndisturbedPayoff(w, undisturbedPayoff, hasUndisturbed, rown, act1, *p);
+          savePayoff(dest, rown, act1, *p, act2, undisturbedPayoff, w.cache);
+        }
+        computePayoff(w, dest, rown, act1, *p, act2, w.cache);
+      } // end for(act2
+    }   // end for(p
+  } // end for(rown, act1
+
+  cached.saveRows(dest, *this);
+  for (int i = 0; i < aggPtr->numPlayers; i++) {
+    cached.projectedStrat[i].swap(w.projectedStrat[currNode][i]);
+  }
+  cached.valid = true;
 }
 
-void aggame::computeUndisturbedPayoff(agg::AggNumber &undisturbedPayoff, bool &has, int player1,
-                                      int act1, int player2) const
+void aggame::computeUndisturbedPayoff(agg::AGG::Workspace &w, agg::AggNumber &undisturbedPayoff,
+                                      bool &has, int player1, int act1, int player2) const
 {
   if (has) {
     return;
@@ -336,19 +421,19 @@ void aggame::computeUndisturbedPayoff(agg::AggNumber &undisturbedPayoff, bool &h
   int Node = aggPtr->actionSets[player1][act1];
   int numNei = aggPtr->neighbors[Node].size();
   if (player2 == player1) {
-    undisturbedPayoff = aggPtr->Pr[player2].inner_prod(aggPtr->payoffs[Node]);
+    undisturbedPayoff = w.Pr[player2].inner_prod(aggPtr->payoffs[Node]);
   }
   else {
-    // assert(aggPtr->projectedStrat[Node][player2].size()==1);
+    // assert(w.projectedStrat[Node][player2].size()==1);
     undisturbedPayoff =
-        aggPtr->Pr[player2].inner_prod(aggPtr->projectedStrat[Node][player2].begin()->first,
+        w.Pr[player2].inner_prod(w.projectedStrat[Node][player2].begin()->first,
                                        numNei, aggPtr->projFunctions[Node], aggPtr->payoffs[Node]);
   }
   has = true;
 }
 
 void aggame::savePayoff(cmatrix &dest, int player1, int act1, int player2, int act2,
-                        agg::AggNumber result, agg::trie_map<agg::AggNumber> &cache,
+                        agg::AggNumber result, agg::config_map<agg::AggNumber> &cache,
                         bool partial) const
 {
 
@@ -378,8 +463,8 @@ void aggame::savePayoff(cmatrix &dest, int player1, int act1, int player2, int a
   dest(act1 + firstAction(player1), act2 + firstAction(player2)) = result;
 }
 
-void aggame::computePayoff(cmatrix &dest, int player1, int act1, int player2, int act2,
-                           agg::trie_map<agg::AggNumber> &cache) const
+void aggame::computePayoff(agg::AGG::Workspace &w, cmatrix &dest, int player1, int act1,
+                           int player2, int act2, agg::config_map<agg::AggNumber> &cache) const
 {
   int Node = aggPtr->actionSets[player1][act1];
   int numNei = aggPtr->neighbors[Node].size();
@@ -389,13 +474,13 @@ void aggame::computePayoff(cmatrix &dest, int player1, int act1, int player2, in
   insPair.first.push_back(player1);
   insPair.first.push_back(act1);
   insPair.first.push_back(player2);
-  std::pair<agg::trie_map<agg::AggNumber>::iterator, bool> r = cache.insert(insPair);
+  std::pair<agg::config_map<agg::AggNumber>::iterator, bool> r = cache.insert(insPair);
   if (!r.second) {
     dest(act1 + firstAction(player1), act2 + firstAction(player2)) = r.first->second;
   }
   else {
     r.first->second =
-        aggPtr->Pr[player2].inner_prod(aggPtr->projection[Node][player2][act2], numNei,
+        w.Pr[player2].inner_prod(aggPtr->projection[Node][player2][act2], numNei,
                                        aggPtr->projFunctions[Node], aggPtr->payoffs[Node]);
     savePayoff(dest, player1, act1, player2, act2, r.first->second, cache, r.second);
   }
@@ -403,6 +488,7 @@ void aggame::computePayoff(cmatrix &dest, int player1, int act1, int player2, in
 
 void aggame::KSymPayoffMatrix(cmatrix &dest, const cvector &s, agg::AggNumber fuzz) const
 {
+  WorkspaceLease lease(*this);
   std::vector<double> sp(s.values(), s.values() + s.getm());
   // simple implementation using expected payoffs:
   for (int rowcls = 0; rowcls < getNumPlayerClasses(); ++rowcls) {
@@ -416,7 +502,7 @@ void aggame::KSymPayoffMatrix(cmatrix &dest, const cvector &s, agg::AggNumber fu
 
           dest(rowa + firstKSymAction(rowcls), cola + firstKSymAction(colcls)) =
               (agg::AggNumber)multiplier *
-              aggPtr->getKSymMixedPayoff(sp, rowcls, rowa, colcls, cola);
+              aggPtr->getKSymMixedPayoff(*lease, sp, rowcls, rowa, colcls, cola);
         }
       }
     }
@@ -24,6 +24,8 @@
 #ifndef GAMBIT_GTRACER_AGGAME_H
 #define GAMBIT_GTRACER_AGGAME_H
 
+#include <memory>
+#include <mutex>
 #include "cmatrix.h"
 #include "gnmgame.h"
 #include "games/agg/agg.h"
@@ -35,24 +37,27 @@ namespace gametracer {
 
 class aggame : public gnmgame {
 public:
-  explicit aggame(const Gambit::GameAGGRep &g)
-    : gnmgame(g.GetUnderlyingAGG()->actions), aggPtr(g.GetUnderlyingAGG())
-  {
-  }
+  explicit aggame(const Gambit::GameAGGRep &g);
 
   ~aggame() override = default;
   int getNumActionNodes() { return aggPtr->getNumActionNodes(); }
 
+  // Sets the number of threads used to compute the payoff Jacobian.
+  // Values less than one select the number of hardware threads.
+  void setNumThreads(int p_threads) { numThreads = p_threads; }
+
   double getMixedPayoff(int player, const cvector &s) const override
   {
+    WorkspaceLease w(*this);
     std::vector<double> sp(s.values(), s.values() + s.getm());
-    return (double)aggPtr->getMixedPayoff(player, sp);
+    return (double)aggPtr->getMixedPayoff(*w, player, sp);
   }
 
-  double getKSymMixedPayoff(int cls, cvector &s)
+  double getKSymMixedPayoff(int cls, const cvector &s) const
   {
+    WorkspaceLease w(*this);
     std::vector<double> sp(s.values(), s.values() + s.getm());
-    return (double)aggPtr->getKSymMixedPayoff(cls, sp);
+    return (double)aggPtr->getKSymMixedPayoff(*w, cls, sp);
   }
 
   void payoffMatrix(cmatrix &dest, const cvector &s, double fuzz) const override;
@@ -66,10 +71,10 @@ public:
 
   void getPayoffVector(cvector &dest, int player, const cvector &s) const override
   {
-    auto ss = const_cast<cvector &>(s);
-    std::vector<double> sp(ss.values(), ss.values() + ss.getm());
+    WorkspaceLease w(*this);
+    std::vector<double> sp(s.values(), s.values() + s.getm());
     std::vector<double> d(aggPtr->getNumActions(player));
-    aggPtr->getPayoffVector(d, player, sp);
+    aggPtr->getPayoffVector(*w, d, player, sp);
     std::copy(d.begin(), d.end(), dest.values());
   }
   double getPurePayoff(int player, const std::vector<int> &s) const override
@@ -83,25 +88,73 @@ public:
   }
 
   int getNumPlayerClasses() const override { return aggPtr->getNumPlayerClasses(); }
+  int getPlayerClass(int player) const override { return aggPtr->getClassOfPlayer(player); }
 
   int getNumKSymActions(int p) const override { return aggPtr->getNumKSymActions(p); }
   int firstKSymAction(int p) const override { return aggPtr->firstKSymAction(p); }
   int lastKSymAction(int p) const override { return aggPtr->lastKSymAction(p); }
 
 private:
-  std::shared_ptr<Gambit::agg::AGG> aggPtr;
-
-  // helper functions for computing jacobian
-  void computePartialP_PureNode(int player, int act, std::vector<int> &tasks) const;
-  void computePartialP_bisect(int player, int act, std::vector<int>::iterator f,
-                              std::vector<int>::iterator l, Gambit::agg::aggdistrib &temp) const;
-  void computePayoff(cmatrix &dest, int player1, int act1, int player2, int act2,
-                     Gambit::agg::trie_map<Gambit::agg::AggNumber> &cache) const;
+  std::shared_ptr<const Gambit::agg::AGG> aggPtr;
+
+  // Workspaces for evaluating payoffs are kept between calls, so that the
+  // storage for their distributions is reused.  Each call leases its own
+  // workspace from the pool, so payoffs may be computed concurrently.
+  mutable std::vector<std::unique_ptr<Gambit::agg::AGG::Workspace>> workspacePool;
+  mutable std::mutex workspaceMutex;
+
+  class WorkspaceLease {
+  public:
+    explicit WorkspaceLease(const aggame &p_game);
+    WorkspaceLease(const WorkspaceLease &) = delete;
+    ~WorkspaceLease();
+    WorkspaceLease &operator=(const WorkspaceLease &) = delete;
+
+    Gambit::agg::AGG::Workspace &operator*() const { return *m_workspace; }
+
+  private:
+    const aggame &m_game;
+    std::unique_ptr<Gambit::agg::AGG::Workspace> m_workspace;
+  };
+
+  int numThreads{0};
+
+  // The rows of the jacobian for the actions at one action node.  These
+  // depend only on the projections of the players' strategies onto the
+  // neighbourhood of the node, so the rows are kept along with the
+  // projected strategies they were computed from, and are recomputed
+  // only when some player's projected strategy changes.
+  struct NodeJacobian {
+    std::mutex mutex;
+    // the (player, action) pairs at the node, in the order rows are computed
+    std::vector<std::pair<int, int>> rows;
+    bool valid{false};
+    std::vector<Gambit::agg::aggdistrib> projectedStrat;
+    std::vector<double> values;
+
+    void saveRows(const cmatrix &dest, const aggame &game);
+    void copyRows(cmatrix &dest, const aggame &game) const;
+  };
+  mutable std::vector<NodeJacobian> jacobianCache;
+
+  // helper functions for computing jacobian.  All scratch storage is held
+  // in the workspace, so the jacobian may be computed concurrently.
+  void computeNodeRows(Gambit::agg::AGG::Workspace &w, cmatrix &dest, int node,
+                       const cvector &s) const;
+  void computePartialP_PureNode(Gambit::agg::AGG::Workspace &w, int player, int act,
+                                std::vector<int> &tasks) const;
+  void computePartialP_bisect(Gambit::agg::AGG::Workspace &w, int player, int act,
+                              std::vector<int>::iterator f, std::vector<int>::iterator l,
+                              Gambit::agg::aggdistrib &temp) const;
+  void computePayoff(Gambit::agg::AGG::Workspace &w, cmatrix &dest, int player1, int act1,
+                     int player2, int act2,
+                     Gambit::agg::config_map<Gambit::agg::AggNumber> &cache) const;
   void savePayoff(cmatrix &dest, int player1, int act1, int player2, int act2,
                   Gambit::agg::AggNumber result,
-                  Gambit::agg::trie_map<Gambit::agg::AggNumber> &cache,
+                  Gambit::agg::config_map<Gambit::agg::AggNumber> &cache,
                   bool partial = false) const;
-  void computeUndisturbedPayoff(Gambit::agg::AggNumber &undisturbedPayoff, bool &has, int player1,
+  void computeUndisturbedPayoff(Gambit::agg::AGG::Workspace &w,
+                                Gambit::agg::AggNumber &undisturbedPayoff, bool &has, int player1,
                                 int act1, int player2) const;
 };
 
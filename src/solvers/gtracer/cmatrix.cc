@@ -27,9 +27,38 @@
 #include "core/matrix.h"
 #include "cmatrix.h"
 
+#ifdef HAVE_LAPACK
+extern "C" void dgesv_(const int *n, const int *nrhs, double *a, const int *lda, int *ipiv,
+                       double *b, const int *ldb, int *info);
+#endif // HAVE_LAPACK
+
 namespace Gambit {
 namespace gametracer {
 
+#ifdef HAVE_LAPACK
+namespace {
+
+// Solves A * dest = b using LAPACK, returning false if A is singular.
+// LAPACK stores matrices by columns, so A is copied transposed.
+bool LapackSolve(const cmatrix &A, const cvector &b, cvector &dest)
+{
+  const int n = A.getn(), nrhs = 1;
+  int info;
+  std::vector<double> a(static_cast<size_t>(n) * n);
+  std::vector<int> ipiv(n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      a[j * n + i] = A(i, j);
+    }
+    dest[i] = b[i];
+  }
+  dgesv_(&n, &nrhs, a.data(), &n, ipiv.data(), dest.values(), &n, &info);
+  return info == 0;
+}
+
+} // end anonymous namespace
+#endif // HAVE_LAPACK
+
 int cmatrix::LUdecomp(cmatrix &LU, std::vector<int> &ix) const
 {
   if (m != n || LU.m != LU.n || LU.n != n) {
@@ -137,6 +166,13 @@ bool cmatrix::solve(cvector &b, cvector &ret) const
   if (m != n) {
     throw std::out_of_range("invalid cmatrix in solve");
   }
+#ifdef HAVE_LAPACK
+  // A singular matrix is left to the decomposition below, which perturbs
+  // zero pivots rather than failing
+  if (LapackSolve(*this, b, ret)) {
+    return true;
+  }
+#endif // HAVE_LAPACK
   for (int i = 0; i < n; i++) {
     ret[i] = b[i];
   }
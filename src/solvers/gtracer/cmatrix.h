@@ -28,11 +28,29 @@
 #include <iostream>
 #include <cmath>
 #include <cstring>
+#include <new>
+#include <utility>
 #include <vector>
 
+#ifdef HAVE_CBLAS
+#include <cblas.h>
+#endif // HAVE_CBLAS
+
 namespace Gambit {
 namespace gametracer {
 
+// Vectors and matrices are stored aligned to a cache line, so that the
+// compiler's vectorised loops over them, and BLAS routines if these are
+// used, can work on whole lines.
+constexpr std::align_val_t VALUES_ALIGNMENT{64};
+
+inline double *AllocateValues(int n)
+{
+  return static_cast<double *>(::operator new[](n * sizeof(double), VALUES_ALIGNMENT));
+}
+
+inline void FreeValues(double *x) { ::operator delete[](x, VALUES_ALIGNMENT); }
+
 class cvector {
   friend class cmatrix;
 
@@ -91,15 +109,21 @@ public:
     bool operator!=(const const_iterator &it) const { return !(*this == it); }
   };
 
-  cvector() : m(1), x(new double[1]) {}
+  cvector() : m(1), x(AllocateValues(1)) {}
+
+  explicit cvector(int m) : m(m), x(AllocateValues(m)) {}
 
-  explicit cvector(int m) : m(m), x(new double[m]) {}
+  ~cvector() { FreeValues(x); }
 
-  ~cvector() { delete[] x; }
+  cvector(const cvector &v) : m(v.m), x(AllocateValues(m)) { memcpy(x, v.x, m * sizeof(double)); }
 
-  cvector(const cvector &v) : m(v.m), x(new double[m]) { memcpy(x, v.x, m * sizeof(double)); }
+  cvector(cvector &&v) noexcept : m(v.m), x(v.x)
+  {
+    v.m = 0;
+    v.x = nullptr;
+  }
 
-  cvector(int m, double a) : m(m), x(new double[m])
+  cvector(int m, double a) : m(m), x(AllocateValues(m))
   {
     for (int i = 0; i < m; i++) {
       x[i] = a;
@@ -129,14 +153,21 @@ public:
       return *this;
     }
     if (v.m != m) {
-      delete[] x;
+      FreeValues(x);
       m = v.m;
-      x = new double[m];
+      x = AllocateValues(m);
     }
     memcpy(x, v.x, m * sizeof(double));
     return *this;
   }
 
+  cvector &operator=(cvector &&v) noexcept
+  {
+    std::swap(m, v.m);
+    std::swap(x, v.x);
+    return *this;
+  }
+
   double operator*(const cvector &v) const
   {
     if (m != v.m) {
@@ -222,6 +253,18 @@ public:
     return *this;
   }
 
+  // adds v * a, without forming v * a as a temporary
+  cvector &addScaled(double a, const cvector &v)
+  {
+    if (v.m != m) {
+      throw std::out_of_range("invalid cvector addition");
+    }
+    for (int i = 0; i < m; i++) {
+      x[i] += v.x[i] * a;
+    }
+    return *this;
+  }
+
   double max() const
   {
     double t, ma = x[0];
@@ -349,23 +392,68 @@ private:
   double *x;
 };
 
-inline cvector operator+(const cvector &a, const cvector &b) { return cvector(a) += b; }
+inline cvector operator+(const cvector &a, const cvector &b)
+{
+  cvector ret(a);
+  ret += b;
+  return ret;
+}
 
-inline cvector operator-(const cvector &a, const cvector &b) { return cvector(a) -= b; }
+inline cvector operator-(const cvector &a, const cvector &b)
+{
+  cvector ret(a);
+  ret -= b;
+  return ret;
+}
 
-inline cvector operator+(const cvector &a, const double &b) { return cvector(a) += b; }
+inline cvector operator+(const cvector &a, const double &b)
+{
+  cvector ret(a);
+  ret += b;
+  return ret;
+}
 
-inline cvector operator-(const cvector &a, const double &b) { return cvector(a) -= b; }
+inline cvector operator-(const cvector &a, const double &b)
+{
+  cvector ret(a);
+  ret -= b;
+  return ret;
+}
 
-inline cvector operator+(const double &a, const cvector &b) { return cvector(b) += a; }
+inline cvector operator+(const double &a, const cvector &b)
+{
+  cvector ret(b);
+  ret += a;
+  return ret;
+}
 
-inline cvector operator-(const double &a, const cvector &b) { return cvector(b.getm(), a) -= b; }
+inline cvector operator-(const double &a, const cvector &b)
+{
+  cvector ret(b.getm(), a);
+  ret -= b;
+  return ret;
+}
 
-inline cvector operator*(const cvector &a, const double &b) { return cvector(a) *= b; }
+inline cvector operator*(const cvector &a, const double &b)
+{
+  cvector ret(a);
+  ret *= b;
+  return ret;
+}
 
-inline cvector operator*(const double &a, const cvector &b) { return cvector(b) *= a; }
+inline cvector operator*(const double &a, const cvector &b)
+{
+  cvector ret(b);
+  ret *= a;
+  return ret;
+}
 
-inline cvector operator/(const cvector &a, const double &b) { return cvector(a) /= b; }
+inline cvector operator/(const cvector &a, const double &b)
+{
+  cvector ret(a);
+  ret /= b;
+  return ret;
+}
 
 inline std::ostream &operator<<(std::ostream &s, const cvector &v)
 {
@@ -385,15 +473,21 @@ public:
     this->m = m;
     this->n = n;
     s = m * n;
-    x = new double[s];
+    x = AllocateValues(s);
   }
 
-  ~cmatrix() { delete[] x; }
+  ~cmatrix() { FreeValues(x); }
+
+  cmatrix(cmatrix &&ma) noexcept : m(ma.m), n(ma.n), s(ma.s), x(ma.x)
+  {
+    ma.m = ma.n = ma.s = 0;
+    ma.x = nullptr;
+  }
 
   cmatrix(const cmatrix &ma, bool transpose = false)
   {
     s = ma.m * ma.n;
-    x = new double[s];
+    x = AllocateValues(s);
     if (transpose) {
       int i, j, c;
       n = ma.m;
@@ -420,7 +514,7 @@ public:
     this->m = m;
     this->n = n;
     s = m * n;
-    x = new double[s];
+    x = AllocateValues(s);
     if (diaonly) {
       int i;
       // for(i=0;i<s;i++) x[i] = 0;
@@ -455,7 +549,7 @@ public:
     this->m = m;
     this->n = n;
     s = m * n;
-    x = new double[s];
+    x = AllocateValues(s);
     // for(int i=0;i<s;i++) x[i] = 0;
     memset(x, 0, s * sizeof(double));
     int l = m;
@@ -475,7 +569,7 @@ public:
     m = v.m;
     n = 1;
     s = m;
-    x = new double[s];
+    x = AllocateValues(s);
     // for(int i=0;i<s;i++) x[i] = v.x[i];
     memcpy(x, v.x, s * sizeof(double));
   }
@@ -488,7 +582,7 @@ public:
       s = 1;
       m = 1;
       n = 1;
-      x = new double[1];
+      x = AllocateValues(1);
       // x[0] = NaN;
       // x[0] = 0.0/0.0;
       x[0] = 0;
@@ -497,7 +591,7 @@ public:
       n = v2.m;
       m = v1.m;
       s = n * m;
-      x = new double[s];
+      x = AllocateValues(s);
       int i, j, k, c = 0;
       for (i = 0; i < m; i++) {
         for (j = 0; j < n; j++, c++) {
@@ -515,7 +609,7 @@ public:
     n = v2.m;
     m = v1.m;
     s = n * m;
-    x = new double[s];
+    x = AllocateValues(s);
     int i, j, c = 0;
     for (i = 0; i < m; i++) {
       for (j = 0; j < n; j++, c++) {
@@ -555,20 +649,33 @@ public:
       s = ma.s;
       m = ma.m;
       n = ma.n;
-      delete[] x;
-      x = new double[s];
+      FreeValues(x);
+      x = AllocateValues(s);
     }
     // for(int i=0;i<s;i++) x[i] = ma.x[i];
     memcpy(x, ma.x, s * sizeof(double));
     return *this;
   }
 
+  cmatrix &operator=(cmatrix &&ma) noexcept
+  {
+    std::swap(m, ma.m);
+    std::swap(n, ma.n);
+    std::swap(s, ma.s);
+    std::swap(x, ma.x);
+    return *this;
+  }
+
   cmatrix operator*(const cmatrix &ma) const
   {
     if (n != ma.m) {
       throw std::out_of_range("invalid cmatrix multiply");
     }
     cmatrix ret(m, ma.n);
+#ifdef HAVE_CBLAS
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, ma.n, n, 1.0, x, n, ma.x, ma.n, 0.0,
+                ret.x, ma.n);
+#else
     int c = 0;
     for (int i = 0; i < m; i++) {
       for (int j = 0; j < ma.n; j++, c++) {
@@ -578,6 +685,7 @@ public:
         }
       }
     }
+#endif // HAVE_CBLAS
     return ret;
   }
 
@@ -587,13 +695,7 @@ public:
       throw std::out_of_range("invalid cvector-cmatrix multiply");
     }
     cvector ret(m);
-    int c = 0;
-    for (int i = 0; i < m; i++, c += n) {
-      ret.x[i] = 0;
-      for (int j = 0; j < n; j++) {
-        ret.x[i] += x[c + j] * v.x[j];
-      }
-    }
+    multiply(v, ret);
     return ret;
   }
 
@@ -777,13 +879,18 @@ public:
   void multiply(const cvector &source, cvector &dest) const
   {
     // assert(n == source.m && m == dest.m);
+#ifdef HAVE_CBLAS
+    cblas_dgemv(CblasRowMajor, CblasNoTrans, m, n, 1.0, x, n, source.x, 1, 0.0, dest.x, 1);
+#else
     int i, j, c = 0;
     for (i = 0; i < m; i++) {
-      dest[i] = 0;
+      double sum = 0.0;
       for (j = 0; j < n; j++, c++) {
-        dest[i] += x[c] * source[j];
+        sum += x[c] * source.x[j];
       }
+      dest.x[i] = sum;
     }
+#endif // HAVE_CBLAS
   }
 
   int getm() const { return m; }
@@ -795,26 +902,68 @@ private:
   double *x;
 };
 
-inline cmatrix operator+(const cmatrix &a, const cmatrix &b) { return cmatrix(a) += b; }
+inline cmatrix operator+(const cmatrix &a, const cmatrix &b)
+{
+  cmatrix ret(a);
+  ret += b;
+  return ret;
+}
 
-inline cmatrix operator-(const cmatrix &a, const cmatrix &b) { return cmatrix(a) -= b; }
+inline cmatrix operator-(const cmatrix &a, const cmatrix &b)
+{
+  cmatrix ret(a);
+  ret -= b;
+  return ret;
+}
 
-inline cmatrix operator+(const cmatrix &a, const double &b) { return cmatrix(a) += b; }
+inline cmatrix operator+(const cmatrix &a, const double &b)
+{
+  cmatrix ret(a);
+  ret += b;
+  return ret;
+}
 
-inline cmatrix operator-(const cmatrix &a, const double &b) { return cmatrix(a) -= b; }
+inline cmatrix operator-(const cmatrix &a, const double &b)
+{
+  cmatrix ret(a);
+  ret -= b;
+  return ret;
+}
 
-inline cmatrix operator+(const double &a, const cmatrix &b) { return cmatrix(b) += a; }
+inline cmatrix operator+(const double &a, const cmatrix &b)
+{
+  cmatrix ret(b);
+  ret += a;
+  return ret;
+}
 
 inline cmatrix operator-(const double &a, const cmatrix &b)
 {
-  return cmatrix(b.getn(), b.getm(), a) -= b;
+  cmatrix ret(b.getn(), b.getm(), a);
+  ret -= b;
+  return ret;
 }
 
-inline cmatrix operator*(const cmatrix &a, const double &b) { return cmatrix(a) *= b; }
+inline cmatrix operator*(const cmatrix &a, const double &b)
+{
+  cmatrix ret(a);
+  ret *= b;
+  return ret;
+}
 
-inline cmatrix operator*(const double &b, const cmatrix &a) { return cmatrix(a) *= b; }
+inline cmatrix operator*(const double &b, const cmatrix &a)
+{
+  cmatrix ret(a);
+  ret *= b;
+  return ret;
+}
 
-inline cmatrix operator/(const cmatrix &a, const double &b) { return cmatrix(a) /= b; }
+inline cmatrix operator/(const cmatrix &a, const double &b)
+{
+  cmatrix ret(a);
+  ret /= b;
+  return ret;
+}
 
 inline std::ostream &operator<<(std::ostream &s, const cmatrix &ma)
 {
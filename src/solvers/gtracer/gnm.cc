@@ -30,13 +30,169 @@ namespace gametracer {
 
 const double BIGFLOAT = 3.0e+28F;
 
+// The Jacobian Dpsi = I - (I+DG)R of the map whose zeros GNM follows, held
+// as an LU factorization.  The columns of R for actions outside the support
+// are zero, so the columns of Dpsi for those actions are those of the
+// identity.  With the actions in the support ordered first,
+//   Dpsi = [ D_SS  0 ]
+//          [ D_US  I ],
+// so only D_SS, whose size is that of the support, need be factored.
+// Then det(Dpsi) = det(D_SS), and Dpsi x = b is solved by x_S = D_SS^-1 b_S
+// and x_U = b_U - D_US x_S.  GNM uses the adjoint of Dpsi, which is
+// det(Dpsi) Dpsi^-1; should D_SS prove to be singular, the adjoint is
+// instead computed explicitly.
+class JacobianFactorization {
+public:
+  explicit JacobianFactorization(int M) : M(M), adj(M, M), position(M) {}
+
+  // Computes Dpsi and factors it, returning its determinant
+  double factor(const cmatrix &DG, const cmatrix &R, const std::vector<int> &support);
+
+  // Sets dest = adj(Dpsi) * source
+  void multiplyAdjoint(const cvector &source, cvector &dest) const;
+
+private:
+  int M, K{0};
+  double det{0.0};
+  bool singular{false};
+  cmatrix adj;                 // the adjoint of Dpsi, when D_SS is singular
+  std::vector<int> support;    // the actions in the support, in order
+  std::vector<int> position;   // the index of each action in support, or -1
+  std::vector<double> columns; // Dpsi(r, support[c]) at r * K + c
+  std::vector<double> lu;      // the factors of D_SS, with rows permuted
+  std::vector<int> pivot;      // the row of D_SS at each row of lu
+  mutable std::vector<double> x;
+};
+
+double JacobianFactorization::factor(const cmatrix &DG, const cmatrix &R,
+                                     const std::vector<int> &p_support)
+{
+  support.clear();
+  for (int i = 0; i < M; i++) {
+    position[i] = (p_support[i]) ? static_cast<int>(support.size()) : -1;
+    if (p_support[i]) {
+      support.push_back(i);
+    }
+  }
+  K = support.size();
+
+  // Column j of (I+DG)R sums over the rows k of R's column j which are
+  // nonzero; these are among the actions in the support.  The terms are
+  // accumulated in increasing order of k, so the entries are those which
+  // the full matrix product would give.
+  columns.resize(M * K);
+  std::vector<int> terms;
+  for (int c = 0; c < K; c++) {
+    const int j = support[c];
+    terms.clear();
+    for (int k : support) {
+      if (R(k, j) != 0.0) {
+        terms.push_back(k);
+      }
+    }
+    for (int r = 0; r < M; r++) {
+      double sum = 0.0;
+      for (int k : terms) {
+        sum += (DG(r, k) + ((r == k) ? 1.0 : 0.0)) * R(k, j);
+      }
+      if (r == j) {
+        sum -= 1.0;
+      }
+      columns[r * K + c] = -sum;
+    }
+  }
+
+  // LU decomposition of D_SS with partial pivoting
+  lu.resize(K * K);
+  pivot.resize(K);
+  for (int c = 0; c < K; c++) {
+    std::copy_n(&columns[support[c] * K], K, &lu[c * K]);
+    pivot[c] = c;
+  }
+  det = 1.0;
+  singular = false;
+  for (int j = 0; j < K; j++) {
+    int best = j;
+    for (int i = j + 1; i < K; i++) {
+      if (std::abs(lu[i * K + j]) > std::abs(lu[best * K + j])) {
+        best = i;
+      }
+    }
+    if (lu[best * K + j] == 0.0) {
+      singular = true;
+      break;
+    }
+    if (best != j) {
+      std::swap_ranges(&lu[j * K], &lu[j * K] + K, &lu[best * K]);
+      std::swap(pivot[j], pivot[best]);
+      det = -det;
+    }
+    const double p = lu[j * K + j];
+    det *= p;
+    for (int i = j + 1; i < K; i++) {
+      const double factor = lu[i * K + j] / p;
+      lu[i * K + j] = factor;
+      if (factor != 0.0) {
+        for (int k = j + 1; k < K; k++) {
+          lu[i * K + k] -= factor * lu[j * K + k];
+        }
+      }
+    }
+  }
+
+  if (singular) {
+    for (int r = 0; r < M; r++) {
+      for (int j = 0; j < M; j++) {
+        adj(r, j) = (position[j] >= 0) ? columns[r * K + position[j]] : ((r == j) ? 1.0 : 0.0);
+      }
+    }
+    det = adj.adjoint();
+  }
+  return det;
+}
+
+void JacobianFactorization::multiplyAdjoint(const cvector &source, cvector &dest) const
+{
+  if (singular) {
+    adj.multiply(source, dest);
+    return;
+  }
+  x.resize(K);
+  for (int i = 0; i < K; i++) {
+    double sum = source[support[pivot[i]]];
+    for (int k = 0; k < i; k++) {
+      sum -= lu[i * K + k] * x[k];
+    }
+    x[i] = sum;
+  }
+  for (int i = K - 1; i >= 0; i--) {
+    double sum = x[i];
+    for (int k = i + 1; k < K; k++) {
+      sum -= lu[i * K + k] * x[k];
+    }
+    x[i] = sum / lu[i * K + i];
+  }
+  for (int r = 0; r < M; r++) {
+    if (position[r] >= 0) {
+      dest[r] = det * x[position[r]];
+    }
+    else {
+      double sum = source[r];
+      for (int c = 0; c < K; c++) {
+        sum -= columns[r * K + c] * x[c];
+      }
+      dest[r] = det * sum;
+    }
+  }
+}
+
 // LNM runs the local Newton method on z to attempt to bring it closer to
 // the image of the graph of the equilibrium correspondence above the ray,
 // under the homeomorphism.  In order to prevent costly memory allocation,
 // a number of scratch vectors are passed in.
-double LNM(const gnmgame &game, cvector &z, const cvector &g, double det, cmatrix &J, cmatrix &DG,
-           cvector &s, int MaxLNM, double fuzz, cvector &del, cvector &scratch, cvector &backup,
-           bool ksym = false)
+double LNM(const gnmgame &game, cvector &z, const cvector &g, double det,
+           const JacobianFactorization &J, cmatrix &DG, cvector &s, int MaxLNM, double fuzz,
+           cvector &del, cvector &scratch, cvector &backup, bool ksym = false)
 {
   double b, e = BIGFLOAT, ee;
   int k, faulted = 0;
@@ -68,7 +224,7 @@ double LNM(const gnmgame &game, cvector &z, const cvector &g, double det, cmatri
         continue;
       }
       e = ee;
-      J.multiply(del, scratch);
+      J.multiplyAdjoint(del, scratch);
       scratch *= b;
       backup = z;
       z -= scratch;
@@ -85,13 +241,15 @@ double LNM(const gnmgame &game, cvector &z, const cvector &g, double det, cmatri
 
 // Find the lone equilibrium of the perturbed game
 void FindUniquePerturbedEquilibrium(const gnmgame &A, const cvector &g, std::vector<int> &s,
-                                    std::vector<int> &B, cvector &G)
+                                    std::vector<int> &B, cvector &G, bool ksym)
 {
-  for (int n = 0; n < A.getNumPlayers(); n++) {
-    double bestPayoff = g[A.firstAction(n)];
-    int bestAction = A.firstAction(n);
+  int numBlocks = (ksym) ? A.getNumPlayerClasses() : A.getNumPlayers();
+  for (int n = 0; n < numBlocks; n++) {
+    int bestAction = (ksym) ? A.firstKSymAction(n) : A.firstAction(n);
+    int endAction = (ksym) ? A.lastKSymAction(n) : A.lastAction(n);
+    double bestPayoff = g[bestAction];
     bool isTie = false;
-    for (int j = bestAction + 1; j < A.lastAction(n); j++) {
+    for (int j = bestAction + 1; j < endAction; j++) {
       if (g[j] > bestPayoff) {
         bestPayoff = g[j];
         bestAction = j;
@@ -114,7 +272,7 @@ void FindUniquePerturbedEquilibrium(const gnmgame &A, const cvector &g, std::vec
 void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz, int LNMFreq,
          int LNMMax, double LambdaMin, bool wobble, double threshold,
          std::function<void(const std::string &, const cvector &)> p_onStep,
-         std::string &returnMessage)
+         std::string &returnMessage, bool ksym)
 {
   int n_hat,          // player whose pure strategy next enters or leaves the support
       s_hat_old = -1, // the last pure strategy to enter or leave the support
@@ -123,7 +281,16 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
       stepsLeft;      // number of linear steps remaining until we hit the boundary
 
   int N = A.getNumPlayers(),
-      M = A.getNumActions(); // the two most important cvector sizes, stored locally for brevity
+      M = (ksym) ? A.getNumKSymActions()
+                 : A.getNumActions(); // the two most important cvector sizes, stored locally
+  // The profile has one block of actions for each player, or for each player
+  // class when computing k-symmetric equilibria
+  int numBlocks = (ksym) ? A.getNumPlayerClasses() : N;
+  auto firstAction = [&A, ksym](int n) {
+    return (ksym) ? A.firstKSymAction(n) : A.firstAction(n);
+  };
+  auto lastAction = [&A, ksym](int n) { return (ksym) ? A.lastKSymAction(n) : A.lastAction(n); };
+
   double det,                // determinant of the jacobian
       newV,                  // utility variable
       lambda,                // current position along the ray
@@ -140,11 +307,9 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
   std::vector<int> B(M); // current support
   std::fill(B.begin(), B.end(), 0);
 
-  cmatrix DG(M, M),     // jacobian of the payoff function
-      R(M, M),          // jacobian of the retraction operator
-      I(M, M, 1, true), // identity
-      Dpsi,             // jacobian of the cvector field
-      J(M, M);          // adjoint of Dpsi
+  cmatrix DG(M, M), // jacobian of the payoff function
+      R(M, M);      // jacobian of the retraction operator
+  JacobianFactorization J(M); // jacobian of the cvector field, giving its adjoint
 
   cvector sigma(M),  // current strategy profile
       g0(M),         // original perturbation ray
@@ -157,12 +322,12 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
 
   // utility variables for use as intermediate values in computations
   cmatrix Y1(M, M), Y2(M, M), Y3(M, M);
-  cvector G(N), yn1(N), ym1(M), ym2(M), ym3(M);
+  cvector G(numBlocks), yn1(numBlocks), ym1(M), ym2(M), ym3(M);
 
   // INITIALIZATION
   Eq.clear();
 
-  FindUniquePerturbedEquilibrium(A, g, s, B, G);
+  FindUniquePerturbedEquilibrium(A, g, s, B, G, ksym);
 
   // initialize sigma to be the pure strategy profile
   // that is the lone equilibrium of the perturbed game
@@ -170,7 +335,7 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
 
   p_onStep("start", sigma);
 
-  A.payoffMatrix(DG, sigma, fuzz);
+  A.payoffMatrix(DG, sigma, fuzz, ksym);
   DG.multiply(sigma, v);
   v /= (double)(N - 1);
 
@@ -180,9 +345,9 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
 
   V = 0;
 
-  for (int n = 0; n < N; n++) {
+  for (int n = 0; n < numBlocks; n++) {
     yn1[n] = v[s[n]];
-    for (int i = A.firstAction(n); i < A.lastAction(n); i++) {
+    for (int i = firstAction(n); i < lastAction(n); i++) {
       if (!B[i]) {
         if (G[n] - g[i] < threshold) {
           g[i] -= threshold;
@@ -209,7 +374,7 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
   z += sigma;
   //  z=sigma+v+g*lambda;
 
-  A.retractJac(R, B);
+  A.retractJac(R, B, ksym);
 
   // this outer while loop executes once for each support boundary
   // that the path crosses.
@@ -219,34 +384,24 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
 
     // take the specified number of steps within these support boundaries.
     for (stepsLeft = steps; stepsLeft > 0; stepsLeft--) {
-      // find J = Adj psi
-      J = I;
-      J += DG;
-      J *= R;
-      J -= I;
-      J.negate();
-      // J = I-((I+DG)*R);
-      det = J.adjoint(); // sets J = adjoint(J)
+      // factor Dpsi = I-((I+DG)*R), to find J = Adj psi
+      det = J.factor(DG, R, B);
 
       // find derivatives of z and lambda
-      J.multiply(g, dz);
+      J.multiplyAdjoint(g, dz);
       dz.negate();
       // dz = -(J*g);
       dlambda = -det;
       R.multiply(dz, ym1);
       DG.multiply(ym1, dv);
       // dv = (DG*(R*dz));
-      ym1 = g;
-      ym1 *= dlambda;
-      dv += ym1;
+      dv.addScaled(dlambda, g);
       // dv += g*dlambda;
 
       // Calculate payoff cvector
       DG.multiply(sigma, v);
       v /= (double)(N - 1);
-      ym1 = g;
-      ym1 *= lambda;
-      v += ym1;
+      v.addScaled(lambda, g);
       // v = DG*sigma / (double)(N-1) + g * lambda;
 
       // Find next action that will enter or leave the support
@@ -255,8 +410,8 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
       // indicates that the action's probability is either
       // becoming 0 or becoming positive.
       minBound = BIGFLOAT;
-      for (int n = 0; n < N; n++) {
-        for (int i = A.firstAction(n); i < A.lastAction(n); i++) {
+      for (int n = 0; n < numBlocks; n++) {
+        for (int i = firstAction(n); i < lastAction(n); i++) {
           // do not cross the same boundary we just crossed
           if (dz[i] != dv[s[n]] && s_hat_old != i) {
             bound = (z[i] - v[s[n]]) / (dv[s[n]] - dz[i]);
@@ -296,25 +451,19 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
           delta = del / stepsLeft;
         }
         else {
-          delta -= -lambda / dlambda; // delta is now just big enough
-          ym1 = dz;                   // to get us to the equilibrium
-          ym1 *= (-lambda / dlambda);
-          z += ym1;
+          // delta is now just big enough to get us to the equilibrium
+          delta -= -lambda / dlambda;
+          z.addScaled(-lambda / dlambda, dz);
           //  z += dz*delta;
           lambda = 0;
-          A.retract(sigma, z);
-          A.payoffMatrix(DG, sigma, fuzz);
+          A.retract(sigma, z, ksym);
+          A.payoffMatrix(DG, sigma, fuzz, ksym);
           ee = 0.0;
           if (N > 2) { // if N=2, the graph is linear, so we are at a
             // precise equilibrium.  otherwise, refine it.
-            J = DG;
-            J += I;
-            J *= R;
-            J -= I;
-            J.negate();
             // J=I-((I+DG)*R);
-            det = J.adjoint();
-            ee = LNM(A, z, nothing, det, J, DG, sigma, LNMMax, fuzz, ym1, ym2, ym3);
+            det = J.factor(DG, R, B);
+            ee = LNM(A, z, nothing, det, J, DG, sigma, LNMMax, fuzz, ym1, ym2, ym3, ksym);
           }
           for (int idx = 0; idx < M; idx++) {
             if (!std::isfinite(sigma[idx])) {
@@ -340,9 +489,7 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
       backup = z;
 
       // do the step
-      ym1 = dz;
-      ym1 *= delta;
-      z += ym1;
+      z.addScaled(delta, dz);
       // z = z+dz*delta;
       lambda += dlambda * delta;
 
@@ -351,8 +498,8 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
       if (lambda < LambdaMin && Index == -1) {
         returnMessage = "too far out in the reverse direction";
       }
-      A.retract(sigma, z);
-      A.payoffMatrix(DG, sigma, fuzz);
+      A.retract(sigma, z, ksym);
+      A.payoffMatrix(DG, sigma, fuzz, ksym);
 
       if (N <= 2) {
         break;
@@ -388,7 +535,7 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
 
       // if we've done LNMMax repetitions, time to get back on the path
       if (stepsLeft > 1 && (++k == LNMFreq)) {
-        LNM(A, z, g0, det, J, DG, sigma, LNMMax, fuzz, ym1, ym2, ym3);
+        LNM(A, z, g0, det, J, DG, sigma, LNMMax, fuzz, ym1, ym2, ym3, ksym);
         k = 0;
       }
     } // end of for loop
@@ -398,7 +545,7 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
     // if a player's current best response is leaving the
     // support, we must find a new one for that player
     if (s[n_hat] == s_hat) {
-      for (int i = A.firstAction(n_hat); i < A.lastAction(n_hat); i++) {
+      for (int i = firstAction(n_hat); i < lastAction(n_hat); i++) {
         if (B[i] && i != s_hat) {
           s[n_hat] = i;
           break;
@@ -406,13 +553,13 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
       }
     }
     B[s_hat] = !B[s_hat];
-    A.retractJac(R, B);
+    A.retractJac(R, B, ksym);
     s_hat_old = s_hat;
-    A.retract(ym1, z);
+    A.retract(ym1, z, ksym);
     sigma = ym1;
     sigma.support(B);
     sigma.unfuzz(fuzz);
-    A.normalizeStrategy(sigma);
+    A.normalizeStrategy(sigma, ksym);
 
     p_onStep(Gambit::lexical_cast<std::string>(lambda), sigma);
 
@@ -422,7 +569,7 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
 
     // wobble the perturbation cvector to put us back on an equilibrium
     if (N > 2 && wobble) {
-      A.payoffMatrix(DG, sigma, fuzz);
+      A.payoffMatrix(DG, sigma, fuzz, ksym);
       DG.multiply(sigma, ym1);
       ym1 /= (double)(N - 1);
       g = z;
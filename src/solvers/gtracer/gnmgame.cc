@@ -68,6 +68,37 @@ void gnmgame::retractJac(cmatrix &dest, const std::vector<int> &support) const
   }
 }
 
+void gnmgame::retractJac(cmatrix &dest, const std::vector<int> &support, bool ksym) const
+{
+  if (!ksym) {
+    retractJac(dest, support);
+    return;
+  }
+  int n, i, j;
+  double totalk;
+  for (n = 0; n < getNumPlayerClasses(); n++) {
+    totalk = 0.0;
+    for (i = firstKSymAction(n); i < lastKSymAction(n); i++) {
+      totalk += support[i];
+    }
+    for (i = 0; i < getNumKSymActions(); i++) {
+      for (j = firstKSymAction(n); j < lastKSymAction(n); j++) {
+        if (i >= firstKSymAction(n) && i < lastKSymAction(n) && support[i] && support[j]) {
+          if (i == j) {
+            dest(i, j) = 1.0 - 1.0 / totalk;
+          }
+          else {
+            dest(i, j) = -1.0 / totalk;
+          }
+        }
+        else {
+          dest(i, j) = 0.0;
+        }
+      }
+    }
+  }
+}
+
 int compareDouble(const void *d1, const void *d2)
 {
   if (*reinterpret_cast<const double *>(d1) > *reinterpret_cast<const double *>(d2)) {
@@ -157,5 +188,42 @@ void gnmgame::normalizeStrategy(cvector &s) const
   }
 }
 
+void gnmgame::normalizeStrategy(cvector &s, bool ksym) const
+{
+  if (!ksym) {
+    normalizeStrategy(s);
+    return;
+  }
+  for (int n = 0; n < getNumPlayerClasses(); n++) {
+    double sum = 0.0;
+    for (int i = firstKSymAction(n); i < lastKSymAction(n); i++) {
+      sum += s[i];
+    }
+    for (int i = firstKSymAction(n); i < lastKSymAction(n); i++) {
+      s[i] /= sum;
+    }
+  }
+}
+
+void gnmgame::expandKSymProfile(cvector &dest, const cvector &s) const
+{
+  for (int n = 0; n < numPlayers; n++) {
+    int offs = firstKSymAction(getPlayerClass(n));
+    for (int i = 0; i < actions[n]; i++) {
+      dest[firstAction(n) + i] = s[offs + i];
+    }
+  }
+}
+
+void gnmgame::projectKSymProfile(cvector &dest, const cvector &s) const
+{
+  for (int n = numPlayers - 1; n >= 0; n--) {
+    int offs = firstKSymAction(getPlayerClass(n));
+    for (int i = 0; i < actions[n]; i++) {
+      dest[offs + i] = s[firstAction(n) + i];
+    }
+  }
+}
+
 } // namespace gametracer
 } // end namespace Gambit
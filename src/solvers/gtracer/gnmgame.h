@@ -86,6 +86,8 @@ public:
   // this stores the Jacobian of the retraction function in dest.
   void retractJac(cmatrix &dest, const std::vector<int> &support) const;
 
+  void retractJac(cmatrix &dest, const std::vector<int> &support, bool ksym) const;
+
   // This retracts z onto the nearest normalized strategy profile, according
   // to the Euclidean metric
   void retract(cvector &dest, const cvector &z) const;
@@ -95,6 +97,21 @@ public:
   // Normalize the strategy profile s by scaling to sum to one.
   void normalizeStrategy(cvector &s) const;
 
+  void normalizeStrategy(cvector &s, bool ksym) const;
+
+  // In a k-symmetric profile, the players are partitioned into classes of
+  // players having identical payoff functions, and all the players in a
+  // class play the same strategy.  Such a profile is stored with one block
+  // of actions per class, indexed by firstKSymAction() and lastKSymAction().
+
+  // Store in dest the profile in which each player plays the strategy of
+  // the player's class in the k-symmetric profile s.
+  void expandKSymProfile(cvector &dest, const cvector &s) const;
+
+  // Store in dest the k-symmetric profile in which each class plays the
+  // strategy of its first player in the profile s.
+  void projectKSymProfile(cvector &dest, const cvector &s) const;
+
   int getNumPlayers() const { return numPlayers; }
 
   int getNumActions() const { return numActions; }
@@ -103,7 +120,9 @@ public:
 
   virtual int getNumPlayerClasses() const { return numPlayers; }
 
-  int getNumKSymActions() const { return numActions; }
+  virtual int getPlayerClass(int player) const { return player; }
+
+  int getNumKSymActions() const { return lastKSymAction(getNumPlayerClasses() - 1); }
 
   virtual int getNumKSymActions(int p) const { return actions[p]; }
 
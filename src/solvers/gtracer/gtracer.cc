@@ -56,6 +56,18 @@ std::shared_ptr<gnmgame> BuildGame(const Game &p_game, bool p_scaled)
   return A;
 }
 
+std::shared_ptr<gnmgame> BuildSymmetricGame(const Game &p_game, bool p_scaled)
+{
+  if (p_game->IsAgg()) {
+    return std::shared_ptr<gnmgame>(new aggame(dynamic_cast<GameAGGRep &>(*p_game)));
+  }
+  auto table = std::make_shared<const SymmetricPayoffTable<double>>(p_game);
+  Rational maxPay = p_game->GetMaxPayoff();
+  Rational minPay = p_game->GetMinPayoff();
+  double scale = (p_scaled && maxPay > minPay) ? 1.0 / (maxPay - minPay) : 1.0;
+  return std::shared_ptr<gnmgame>(new symgame(table, static_cast<double>(minPay), scale));
+}
+
 cvector ToPerturbation(const MixedStrategyProfile<double> &p_pert)
 {
   auto strategies = p_pert.GetGame()->GetStrategies();
@@ -96,5 +108,21 @@ MixedStrategyProfile<double> ToProfile(const Game &p_game, const cvector &p_prof
   return msp;
 }
 
+cvector ToKSymPerturbation(const gnmgame &p_rep, const MixedStrategyProfile<double> &p_pert)
+{
+  cvector g(p_rep.getNumKSymActions());
+  p_rep.projectKSymProfile(g, ToPerturbation(p_pert));
+  g /= g.norm();
+  return g;
+}
+
+MixedStrategyProfile<double> ToKSymProfile(const Game &p_game, const gnmgame &p_rep,
+                                           const cvector &p_profile)
+{
+  cvector profile(p_rep.getNumActions());
+  p_rep.expandKSymProfile(profile, p_profile);
+  return ToProfile(p_game, profile);
+}
+
 } // namespace gametracer
 } // namespace Gambit
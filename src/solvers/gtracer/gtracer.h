@@ -29,6 +29,7 @@
 #include "cmatrix.h"
 #include "nfgame.h"
 #include "aggame.h"
+#include "symgame.h"
 #include "gambit.h"
 
 namespace Gambit {
@@ -57,10 +58,14 @@ namespace gametracer {
 ///                   wobbles are disabled, GNM will terminate if the error
 ///                   reaches this threshold.
 /// @param p_onStep   a callback function executed on each step of the algorithm
+/// @param ksym       whether to compute k-symmetric equilibria, in which all the
+///                   players in a class play the same strategy.  The perturbation
+///                   ray and the profiles computed then have one block of actions
+///                   per player class.
 void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz, int LNMFreq,
          int LNMMax, double LambdaMin, bool wobble, double threshold,
          std::function<void(const std::string &, const cvector &)> p_onStep,
-         std::string &returnMessage);
+         std::string &returnMessage, bool ksym = false);
 
 /// @brief Execute the Govindan-Wilson Iterated Polymatrix algorithm for computing a
 ///        Nash equilibrium
@@ -75,14 +80,26 @@ void GNM(gnmgame &A, cvector &g, std::list<cvector> &Eq, int steps, double fuzz,
 /// @param maxiter the maximum number of iterations to attempt
 /// @param verbose whether to print intermediate information on the progress of the
 ///                algorithm
+/// @param ksym    whether to compute a k-symmetric equilibrium; as for GNM
 int IPA(const gnmgame &A, const cvector &g, cvector &zh, double alpha, double fuzz, cvector &ans,
-        unsigned int maxiter = 100, bool p_verbose = false);
+        unsigned int maxiter = 100, bool p_verbose = false, bool ksym = false);
 
 /// @brief Build a Gametracer representation based on a Gambit game
 /// @param p_game  The game to convert to Gametracer's representation
 /// @param p_scaled  Whether to rescale the payoffs to be on [0, 1]
 std::shared_ptr<gnmgame> BuildGame(const Game &p_game, bool p_scaled);
 
+/// @brief Build a Gametracer representation of a game suited to computing its
+///        k-symmetric equilibria
+/// @details For action graph games, the player classes are the sets of players
+///          with the same actions.  Other games must be symmetric; they are stored
+///          with one payoff per configuration, and have one player class.
+/// @param p_game  The game to convert to Gametracer's representation
+/// @param p_scaled  Whether to rescale the payoffs to be on [0, 1]
+/// @exception UndefinedException  If the game is not an action graph game and
+///                                is not symmetric
+std::shared_ptr<gnmgame> BuildSymmetricGame(const Game &p_game, bool p_scaled);
+
 /// @brief Convert a Gambit mixed strategy profile to a normalized Gametracer
 ///        perturbation vector
 /// @exception std::domain_error  If the perturbation vector \p g is not generic,
@@ -93,6 +110,16 @@ cvector ToPerturbation(const MixedStrategyProfile<double> &p_profile);
 /// @brief Convert a Gametracer vector to a mixed strategy profile on a Gambit game
 MixedStrategyProfile<double> ToProfile(const Game &p_game, const cvector &p_profile);
 
+/// @brief Convert a Gambit mixed strategy profile to a normalized k-symmetric
+///        perturbation vector, taking the perturbation of each player class from
+///        its first player
+cvector ToKSymPerturbation(const gnmgame &p_rep, const MixedStrategyProfile<double> &p_profile);
+
+/// @brief Convert a k-symmetric Gametracer vector to a mixed strategy profile on
+///        a Gambit game, in which each player plays the strategy of the player's class
+MixedStrategyProfile<double> ToKSymProfile(const Game &p_game, const gnmgame &p_rep,
+                                           const cvector &p_profile);
+
 } // namespace gametracer
 } // end namespace Gambit
 
@@ -27,6 +27,8 @@
 namespace Gambit {
 namespace gametracer {
 
+const double BIGFLOAT = 3.0e+28F;
+
 int indexOf(const std::vector<int> &list, int target)
 {
   for (size_t i = 0; i < list.size(); i++) {
@@ -43,12 +45,30 @@ int Pivot(cmatrix &T, int pr, int pc, std::vector<int> &row, std::vector<int> &c
   double pivot = T(pr, pc);
   int i0, j0, p, sgn = pivot < 0 ? -1 : 1;
 
+  // The tableau of a polymatrix game is sparse, as each player's payoffs do
+  // not depend on their own actions, so only the nonzero entries of the
+  // pivot row contribute to the elimination.
+  std::vector<int> nonzero;
+  for (j0 = 0; j0 < numActions + numPlayers + 2; j0++) {
+    if (j0 != pc && T(pr, j0) != 0.0) {
+      nonzero.push_back(j0);
+    }
+  }
   for (i0 = 0; i0 < numActions + numPlayers; i0++) {
     if (i0 != pr) {
+      const double factor = T(i0, pc);
       for (j0 = 0; j0 < numActions + numPlayers + 2; j0++) {
         if (j0 != pc) {
           T(i0, j0) *= pivot;
-          T(i0, j0) -= T(i0, pc) * T(pr, j0);
+        }
+      }
+      if (factor != 0.0) {
+        for (int j : nonzero) {
+          T(i0, j) -= factor * T(pr, j);
+        }
+      }
+      for (j0 = 0; j0 < numActions + numPlayers + 2; j0++) {
+        if (j0 != pc) {
           T(i0, j0) /= D * sgn;
         }
       }
@@ -76,10 +96,10 @@ int Pivot(cmatrix &T, int pr, int pc, std::vector<int> &row, std::vector<int> &c
   return p;
 }
 
-void LemkeHowson(const gnmgame &game, cvector &dest, cmatrix &T, std::vector<int> &Im)
+void LemkeHowson(const gnmgame &game, cvector &dest, cmatrix &T, std::vector<int> &Im, bool ksym)
 {
-  const double BIGFLOAT = 3.0e+28F;
-  int numActions = game.getNumActions(), numPlayers = game.getNumPlayers();
+  int numActions = (ksym) ? game.getNumKSymActions() : game.getNumActions(),
+      numPlayers = (ksym) ? game.getNumPlayerClasses() : game.getNumPlayers();
   double D = 1;
   int cg = numActions + numPlayers;
   int K = cg + 1;
@@ -141,14 +161,131 @@ void LemkeHowson(const gnmgame &game, cvector &dest, cmatrix &T, std::vector<int
   }
 }
 
+// Solves the polymatrix game in the tableau T, as initialised by
+// InitialiseLHTableau, starting from the complementary basis in which the
+// actions in the support, and each player's payoff, are basic.  This is the
+// basis of the solution of a nearby game, which is often feasible, or nearly
+// so, for this one.  The covering vector of Lemke's algorithm is replaced by
+// one which is a vector of ones in the coordinates of this basis, so that
+// pivoting it in makes the basis feasible.  Returns false if the basis is
+// singular, or the path ends in a ray, in which case the game must instead
+// be solved from the beginning, with a freshly initialised tableau.
+bool WarmLemkeHowson(const gnmgame &game, cvector &dest, cmatrix &T,
+                     const std::vector<int> &support, bool ksym)
+{
+  int numActions = (ksym) ? game.getNumKSymActions() : game.getNumActions(),
+      numPlayers = (ksym) ? game.getNumPlayerClasses() : game.getNumPlayers();
+  double D = 1;
+  int cg = numActions + numPlayers;
+  int K = cg + 1;
+  int pc, pr, p;
+  double m;
+  std::vector<int> col(numActions + numPlayers + 2);
+  std::vector<int> row(numActions + numPlayers);
+  for (int n = 0; n < numActions + numPlayers + 2; n++) {
+    col[n] = n + 1;
+  }
+  for (int n = 0; n < numActions + numPlayers; n++) {
+    row[n] = -n - 1;
+  }
+  auto isPayoff = [numActions, numPlayers](int label) {
+    return label > numActions && label <= numActions + numPlayers;
+  };
+
+  // Pivot in the actions in the support and the players' payoffs, in place
+  // of the slacks of those actions and the players' normalisation
+  // constraints.  Each leaving row is chosen to give the largest pivot.
+  std::vector<int> entering, leaving;
+  for (int n = 0; n < numPlayers; n++) {
+    int first = (ksym) ? game.firstKSymAction(n) : game.firstAction(n);
+    int last = (ksym) ? game.lastKSymAction(n) : game.lastAction(n);
+    for (int i = first; i < last; i++) {
+      if (support[i]) {
+        entering.push_back(i + 1);
+        leaving.push_back(-i - 1);
+      }
+    }
+    entering.push_back(numActions + n + 1);
+    leaving.push_back(-numActions - n - 1);
+  }
+  for (int label : entering) {
+    pc = indexOf(col, label);
+    pr = -1;
+    m = 0.0;
+    for (int n = 0; n < numActions + numPlayers; n++) {
+      if (std::find(leaving.cbegin(), leaving.cend(), row[n]) != leaving.cend() &&
+          std::abs(T(n, pc)) > m) {
+        m = std::abs(T(n, pc));
+        pr = n;
+      }
+    }
+    if (pr == -1 || m < 1.0e-12 * D) {
+      return false;
+    }
+    leaving.erase(std::find(leaving.begin(), leaving.end(), row[pr]));
+    Pivot(T, pr, pc, row, col, D, numActions, numPlayers);
+  }
+
+  pc = indexOf(col, cg + 1);
+  for (int n = 0; n < numPlayers + numActions; n++) {
+    T(n, pc) = (isPayoff(row[n])) ? 0.0 : -D;
+  }
+  m = 0.0;
+  pr = -1;
+  for (int n = 0; n < numPlayers + numActions; n++) {
+    if (T(n, pc) < 0 && T(n, K) / T(n, pc) > m) {
+      m = T(n, K) / T(n, pc);
+      pr = n;
+    }
+  }
+
+  if (pr != -1) {
+    // As each pivot leaves a distinct basis, a path much longer than the
+    // number of variables indicates cycling under degeneracy
+    int pivotsLeft = 10 * (numActions + numPlayers);
+    p = Pivot(T, pr, pc, row, col, D, numActions, numPlayers);
+    do {
+      pc = indexOf(col, -p);
+      m = BIGFLOAT;
+      pr = -1;
+      for (int n = 0; n < numPlayers + numActions; n++) {
+        if (T(n, pc) > 0 && !isPayoff(row[n])) {
+          if (T(n, K) / T(n, pc) < m) {
+            m = T(n, K) / T(n, pc);
+            pr = n;
+          }
+        }
+      }
+      if (pr == -1 || --pivotsLeft == 0) {
+        return false;
+      }
+      p = Pivot(T, pr, pc, row, col, D, numActions, numPlayers);
+    } while (p != cg + 1);
+  }
+  for (int n = 0; n < numActions; n++) {
+    pr = indexOf(row, n + 1);
+    if (pr == -1) {
+      dest[n] = 0.0;
+    }
+    else {
+      dest[n] = T(pr, K) / D;
+    }
+  }
+  return true;
+}
+
 // Initialize the Lemke-Howson tableau
-void InitialiseLHTableau(cmatrix &T, const gnmgame &game, const cmatrix &DG, const cvector &g)
+void InitialiseLHTableau(cmatrix &T, const gnmgame &game, const cmatrix &DG, const cvector &g,
+                         bool ksym)
 {
-  int N = game.getNumPlayers(), M = game.getNumActions();
+  int N = (ksym) ? game.getNumPlayerClasses() : game.getNumPlayers(),
+      M = (ksym) ? game.getNumKSymActions() : game.getNumActions();
 
   for (int n = 0; n < N; n++) {
+    int first = (ksym) ? game.firstKSymAction(n) : game.firstAction(n);
+    int last = (ksym) ? game.lastKSymAction(n) : game.lastAction(n);
     for (int i = 0; i < M + N; i++) {
-      if (i >= game.firstAction(n) && i < game.lastAction(n)) {
+      if (i >= first && i < last) {
         T(M + n, i) = 1;
         T(i, M + n) = -1;
       }
@@ -183,16 +320,21 @@ void InitialiseLHTableau(cmatrix &T, const gnmgame &game, const cmatrix &DG, con
 /// @param g    The perturbation vector, with length equal to the number of
 ///             strategies in the game
 /// @param Im   The vector of best response indices, one for each player
+/// @param ksym  Whether the perturbation vector is k-symmetric, in which case
+///              there is one best response for each player class
 /// @exception std::domain_error  If the perturbation vector \p g is not generic,
 ///                               that is, if each player does not have a unique
 ///                               maximizing strategy
-void FindPerturbedBR(const gnmgame &A, const cvector &g, std::vector<int> &Im)
+void FindPerturbedBR(const gnmgame &A, const cvector &g, std::vector<int> &Im, bool ksym)
 {
-  for (int n = 0; n < A.getNumPlayers(); n++) {
-    double bestPayoff = g[A.firstAction(n)];
+  int numBlocks = (ksym) ? A.getNumPlayerClasses() : A.getNumPlayers();
+  for (int n = 0; n < numBlocks; n++) {
+    int first = (ksym) ? A.firstKSymAction(n) : A.firstAction(n);
+    int last = (ksym) ? A.lastKSymAction(n) : A.lastAction(n);
+    double bestPayoff = g[first];
     bool isTie = false;
-    Im[n] = A.firstAction(n);
-    for (int j = A.firstAction(n) + 1; j < A.lastAction(n); j++) {
+    Im[n] = first;
+    for (int j = first + 1; j < last; j++) {
       if (g[j] > bestPayoff) {
         bestPayoff = g[j];
         Im[n] = j;
@@ -210,17 +352,20 @@ void FindPerturbedBR(const gnmgame &A, const cvector &g, std::vector<int> &Im)
 }
 
 int IPA(const gnmgame &A, const cvector &g, cvector &zh, double alpha, double fuzz, cvector &ans,
-        unsigned int maxiter, bool p_verbose)
+        unsigned int maxiter, bool p_verbose, bool ksym)
 {
-  int N = A.getNumPlayers(),
-      M = A.getNumActions(); // For easy reference
-  std::vector<int> Im(N);    // best actions in perturbed game
+  // The approximating polymatrix game has one "player" for each player, or for
+  // each player class when computing a k-symmetric equilibrium.  N remains the
+  // number of players in the game, and NB is the number of blocks.
+  int N = A.getNumPlayers(), NB = (ksym) ? A.getNumPlayerClasses() : N,
+      M = (ksym) ? A.getNumKSymActions() : A.getNumActions(); // For easy reference
+  std::vector<int> Im(NB); // best actions in perturbed game
 
-  cmatrix DG(M, M), O(N, N, 0), // matrix of zeroes
-      S(N, M, 0),               //
-      I(M + N, M + N, 1, true), // identity
-      T(M + N, M + N + 2, 0),   // tableau for Lemke-Howson
-      T2(M + N, M + N, 0);      // submatrix of tableau used if Lemke-Howson is unnecessary
+  cmatrix DG(M, M), O(NB, NB, 0), // matrix of zeroes
+      S(NB, M, 0),                //
+      I(M + NB, M + NB, 1, true), // identity
+      T(M + NB, M + NB + 2, 0),   // tableau for Lemke-Howson
+      T2(M + NB, M + NB, 0);      // submatrix of tableau used if Lemke-Howson is unnecessary
 
   cvector d(M), // diff
       u(M),
@@ -233,21 +378,21 @@ int IPA(const gnmgame &A, const cvector &g, cvector &zh, double alpha, double fu
       z(M),      // current point in game-space
       zt(M),     // next approximating point
       ym1(M),    // utility vars
-      ym2(M), ymn1(M + N), ymn2(M + N);
+      ym2(M), ymn1(M + NB), ymn2(M + NB);
 
-  FindPerturbedBR(A, g, Im);
-  A.retract(sh, zh);
+  FindPerturbedBR(A, g, Im, ksym);
+  A.retract(sh, zh, ksym);
   so = sh;
 
   for (unsigned int iter = 1; iter <= maxiter; iter++) {
-    A.payoffMatrix(DG, sh, 0.0);
+    A.payoffMatrix(DG, sh, 0.0, ksym);
     DG /= (double)(N - 1); // find the Jacobian of the approximating bimatrix game
 
-    InitialiseLHTableau(T, A, DG, g);
+    InitialiseLHTableau(T, A, DG, g, ksym);
 
     // copy the tableau to T2
-    for (int i = 0; i < M + N; i++) {
-      for (int j = 0; j < M + N; j++) {
+    for (int i = 0; i < M + NB; i++) {
+      for (int j = 0; j < M + NB; j++) {
         T2(i, j) = T(i, j);
       }
     }
@@ -255,13 +400,13 @@ int IPA(const gnmgame &A, const cvector &g, cvector &zh, double alpha, double fu
     // zero out columns not in the support
     for (int i = 0; i < M; i++) {
       if (so[i] <= 0.0) {
-        for (int j = 0; j < M + N; j++) {
+        for (int j = 0; j < M + NB; j++) {
           T2(j, i) = (i == j) ? 1.0 : 0.0;
         }
       }
     }
 
-    for (int i = 0; i < M + N; i++) {
+    for (int i = 0; i < M + NB; i++) {
       ymn1[i] = (i < M) ? 0.0 : 1.0;
     }
 
@@ -272,8 +417,18 @@ int IPA(const gnmgame &A, const cvector &g, cvector &zh, double alpha, double fu
     }
 
     if (s.min() < 0.0) {
-      // update support and solve
-      LemkeHowson(A, s, T, Im);
+      // update support and solve, starting from the basis of the previous
+      // solution if there is one
+      std::vector<int> support(M);
+      for (int i = 0; i < M; i++) {
+        support[i] = (so[i] > 0.0);
+      }
+      if (iter == 1 || !WarmLemkeHowson(A, s, T, support, ksym)) {
+        if (iter > 1) {
+          InitialiseLHTableau(T, A, DG, g, ksym);
+        }
+        LemkeHowson(A, s, T, Im, ksym);
+      }
     }
     else {
       // limit to current support
@@ -303,9 +458,8 @@ int IPA(const gnmgame &A, const cvector &g, cvector &zh, double alpha, double fu
     ym1 -= sh;
     double ell = (ym1 * u) / u.norm2(); // dot product
     if (ell <= 0.0 || B) {
-      zh = u;
-      zh *= ell;
-      zh += sh;
+      zh = sh;
+      zh.addScaled(ell, u);
       yh -= sho;
       yh *= ell;
       yh += sho;
@@ -326,7 +480,7 @@ int IPA(const gnmgame &A, const cvector &g, cvector &zh, double alpha, double fu
     // we've got an approximate equilibrium, so we can quit
     if (N <= 2 || (ym1.norm() < fuzz || ym2.norm() < fuzz)) {
       ans = s;
-      A.payoffMatrix(DG, s, 0.0);
+      A.payoffMatrix(DG, s, 0.0, ksym);
       return 1;
     }
     ym1 = z;
@@ -362,10 +516,10 @@ int IPA(const gnmgame &A, const cvector &g, cvector &zh, double alpha, double fu
     sho = sh;
     yh = zh;
     zh = zt;
-    A.retract(sh, zh);
+    A.retract(sh, zh, ksym);
 
     sh.unfuzz(fuzz);
-    A.normalizeStrategy(sh);
+    A.normalizeStrategy(sh, ksym);
   }
   // Max iterations reached
   return 0;
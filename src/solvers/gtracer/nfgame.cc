@@ -22,6 +22,7 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include <algorithm>
 #include <numeric>
 #include <vector>
 #include "cmatrix.h"
@@ -52,133 +53,115 @@ int nfgame::findIndex(int player, const std::vector<int> &s) const
   return retIndex;
 }
 
+//
+// The payoff computations below reduce a player's payoff table by taking
+// expectations over the actions of one player at a time, starting from the
+// last player.  Reductions never modify the table itself: the first one
+// writes into a workspace, and subsequent ones are done in place at the
+// front of that workspace.  A workspace of blockSize[numPlayers - 1]
+// entries is sufficient for any reduction.
+//
+
 double nfgame::getMixedPayoff(int player, const cvector &s) const
 {
-  std::vector<double> m(blockSize[numPlayers]);
-  memcpy(m.data(), payoffs.values() + player * blockSize[numPlayers],
-         blockSize[numPlayers] * sizeof(double));
-  return localPayoff(s, m.data(), numPlayers - 1);
+  std::vector<double> work(blockSize[numPlayers - 1]);
+  return localPayoff(s, payoffs.values() + player * blockSize[numPlayers], numPlayers - 1,
+                     work.data());
 }
 
 void nfgame::getPayoffVector(cvector &dest, int player, const cvector &s) const
 {
-  std::vector<double> t(payoffs.values() + player * blockSize[numPlayers],
-                        payoffs.values() + (player + 1) * blockSize[numPlayers]);
-
-  localPayoffVector(dest.values(), player, const_cast<cvector &>(s), &(t[0]), numPlayers - 1);
+  std::vector<double> work(blockSize[numPlayers - 1]);
+  localPayoffVector(dest.values(), player, s, payoffs.values() + player * blockSize[numPlayers],
+                    numPlayers - 1, work.data());
 }
 
 void nfgame::payoffMatrix(cmatrix &dest, const cvector &s, double fuzz) const
 {
-  int rown, coln, rowi, coli;
-  double fuzzcount;
-  std::vector<double> m(blockSize[numPlayers]);
-  std::vector<double> local(maxActions * maxActions);
-  for (rown = 0; rown < numPlayers; rown++) {
-    for (coln = 0; coln < numPlayers; coln++) {
-      if (rown == coln) {
-        fuzzcount = fuzz;
-        for (rowi = firstAction(rown); rowi < lastAction(rown); rowi++) {
-          for (coli = firstAction(coln); coli < lastAction(coln); coli++) {
-            dest(rowi, coli) = fuzzcount;
-            fuzzcount += fuzz;
-          }
-        }
-      }
-      else {
-        // set m to be the payoffs for player rown
-        memcpy(m.data(), payoffs.values() + rown * blockSize[numPlayers],
-               blockSize[numPlayers] * sizeof(double));
-        localPayoffMatrix(local.data(), rown, coln, s, m.data(), numPlayers - 1);
-        for (rowi = firstAction(rown); rowi < lastAction(rown); rowi++) {
-          for (coli = firstAction(coln); coli < lastAction(coln); coli++) {
-            if (rown > coln) {
-              dest(rowi, coli) = *(local.data() + (rowi - firstAction(rown)) * actions[coln] +
-                                   (coli - firstAction(coln)));
-            }
-            else {
-              dest(rowi, coli) = *(local.data() + (coli - firstAction(coln)) * actions[rown] +
-                                   (rowi - firstAction(rown)));
-            }
-          }
-        }
+  std::vector<double> reduced(blockSize[numPlayers - 1]), work(blockSize[numPlayers - 1]);
+  std::vector<double> local(maxActions);
+  for (int rown = 0; rown < numPlayers; rown++) {
+    double fuzzcount = fuzz;
+    for (int rowi = firstAction(rown); rowi < lastAction(rown); rowi++) {
+      for (int coli = firstAction(rown); coli < lastAction(rown); coli++) {
+        dest(rowi, coli) = fuzzcount;
+        fuzzcount += fuzz;
       }
     }
-  }
-}
 
-// assumes m = memcpy(m, payoffs + blockSize[numPlayers] * player1,
-// blockSize[numPlayers]*sizeof(double)), player1 != player2 i.e. m points to payoff cmatrix for
-// the desired player
-
-void nfgame::localPayoffMatrix(double *dest, int player1, int player2, const cvector &s, double *m,
-                               int n) const
-{
-  int i;
-  if (player1 == n) {
-    for (i = 0; i < actions[player1]; i++) {
-      localPayoffVector(dest + i * actions[player2], player2, s, m + i * blockSize[player1],
-                        n - 1);
+    // The block for players rown and coln depends on rown's payoffs reduced
+    // over all players after max(rown, coln).  These reductions are shared:
+    // the blocks for coln > rown are computed from the last player down,
+    // reducing over coln once its block is done; what remains then serves
+    // for all coln < rown.
+    const double *m = payoffs.values() + rown * blockSize[numPlayers];
+    for (int coln = numPlayers - 1; coln > rown; coln--) {
+      for (int coli = 0; coli < actions[coln]; coli++) {
+        localPayoffVector(local.data(), rown, s, m + coli * blockSize[coln], coln - 1,
+                          work.data());
+        for (int rowi = 0; rowi < actions[rown]; rowi++) {
+          dest(firstAction(rown) + rowi, firstAction(coln) + coli) = local[rowi];
+        }
+      }
+      m = scaleMatrix(s, m, coln, reduced.data());
     }
-  }
-  else if (player2 == n) {
-    for (i = 0; i < actions[player2]; i++) {
-      localPayoffVector(dest + i * actions[player1], player1, s, m + i * blockSize[player2],
-                        n - 1);
+    for (int coln = 0; coln < rown; coln++) {
+      for (int rowi = 0; rowi < actions[rown]; rowi++) {
+        localPayoffVector(&dest(firstAction(rown) + rowi, firstAction(coln)), coln, s,
+                          m + rowi * blockSize[rown], rown - 1, work.data());
+      }
     }
   }
-  else {
-    m = scaleMatrix(s, m, n);
-    localPayoffMatrix(dest, player1, player2, s, m, n - 1);
-  }
 }
 
-double *nfgame::scaleMatrix(const cvector &s, double *m, int n) const
+// Takes the expectation of the block m over the actions of player n,
+// writing the result, of blockSize[n] entries, to dest.  dest may be m
+// itself; the expectation is then taken in place.
+const double *nfgame::scaleMatrix(const cvector &s, const double *m, int n, double *dest) const
 {
-  int i, j, curbase, newbase = -1;
-  double scale;
-  for (i = 0; i < actions[n]; i++) {
+  bool first = true;
+  for (int i = 0; i < actions[n]; i++) {
     if (s[i + firstAction(n)] > 0.0) {
-      scale = s[i + firstAction(n)];
-      curbase = i * blockSize[n];
-      if (newbase < 0) {
-        newbase = curbase;
-        for (j = curbase; j < curbase + blockSize[n]; j++) {
-          m[j] *= scale;
+      const double scale = s[i + firstAction(n)];
+      const double *cur = m + i * blockSize[n];
+      if (first) {
+        for (int j = 0; j < blockSize[n]; j++) {
+          dest[j] = cur[j] * scale;
         }
+        first = false;
       }
       else {
-        for (j = 0; j < blockSize[n]; j++) {
-          m[newbase + j] += scale * m[curbase + j];
+        for (int j = 0; j < blockSize[n]; j++) {
+          dest[j] += scale * cur[j];
         }
       }
     }
   }
-  return m + newbase;
+  if (first) {
+    std::fill(dest, dest + blockSize[n], 0.0);
+  }
+  return dest;
 }
 
-void nfgame::localPayoffVector(double *dest, int player, const cvector &s, double *m, int n) const
+void nfgame::localPayoffVector(double *dest, int player, const cvector &s, const double *m, int n,
+                               double *work) const
 {
-  if (player == n) {
-    for (int i = 0; i < actions[player]; i++) {
-      dest[i] = localPayoff(s, m + i * blockSize[player], n - 1);
-    }
+  for (; n > player; n--) {
+    m = scaleMatrix(s, m, n, work);
   }
-  else {
-    m = scaleMatrix(s, m, n);
-    localPayoffVector(dest, player, s, m, n - 1);
+  for (int i = 0; i < actions[player]; i++) {
+    // Once m is in the workspace, each action's slice is reduced in place
+    dest[i] = localPayoff(s, m + i * blockSize[player], player - 1,
+                          (m == work) ? work + i * blockSize[player] : work);
   }
 }
 
-double nfgame::localPayoff(const cvector &s, double *m, int n) const
+double nfgame::localPayoff(const cvector &s, const double *m, int n, double *work) const
 {
-  if (n < 0) {
-    return *m;
-  }
-  else {
-    m = scaleMatrix(s, m, n);
-    return localPayoff(s, m, n - 1);
+  for (; n >= 0; n--) {
+    m = scaleMatrix(s, m, n, work);
   }
+  return *m;
 }
 
 } // namespace gametracer
@@ -60,14 +60,12 @@ public:
 private:
   int findIndex(int player, const std::vector<int> &s) const;
 
-  void localPayoffMatrix(double *dest, int player1, int player2, const cvector &s, double *m,
-                         int n) const;
+  void localPayoffVector(double *dest, int player, const cvector &s, const double *m, int n,
+                         double *work) const;
 
-  void localPayoffVector(double *dest, int player, const cvector &s, double *m, int n) const;
+  double localPayoff(const cvector &s, const double *m, int n, double *work) const;
 
-  double localPayoff(const cvector &s, double *m, int n) const;
-
-  double *scaleMatrix(const cvector &s, double *m, int n) const;
+  const double *scaleMatrix(const cvector &s, const double *m, int n, double *dest) const;
 
   cvector payoffs;
   std::vector<int> blockSize;
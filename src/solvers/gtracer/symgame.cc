@@ -0,0 +1,172 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/solvers/gtracer/symgame.cc
+// Implementation of GNM-specific routines for symmetric strategic games
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include "symgame.h"
+
+namespace Gambit {
+namespace gametracer {
+
+symgame::symgame(const std::shared_ptr<const SymmetricPayoffTable<double>> &p_table,
+                 double p_offset, double p_scale)
+  : gnmgame(std::vector<int>(p_table->NumPlayers(), p_table->NumStrategies())), table(p_table),
+    offset(p_offset), scale(p_scale)
+{
+}
+
+double symgame::getPurePayoff(int player, const std::vector<int> &s) const
+{
+  std::vector<int> counts(actions[0], 0);
+  for (int n = 0; n < numPlayers; n++) {
+    if (n != player) {
+      counts[s[n]]++;
+    }
+  }
+  return payoff(s[player], table->GetConfiguration(counts));
+}
+
+double symgame::getMixedPayoff(int player, const cvector &s) const
+{
+  cvector v(actions[player]);
+  getPayoffVector(v, player, s);
+  double total = 0.0;
+  for (int i = 0; i < actions[player]; i++) {
+    total += s[firstAction(player) + i] * v[i];
+  }
+  return total;
+}
+
+double symgame::getSymMixedPayoff(const cvector &s)
+{
+  Vector<double> probs(actions[0]), values(actions[0]);
+  std::copy(s.values(), s.values() + actions[0], probs.begin());
+  table->GetStrategyValues(probs, values);
+  double total = 0.0;
+  for (int i = 0; i < actions[0]; i++) {
+    total += s[i] * scale * (values[i + 1] - offset);
+  }
+  return total;
+}
+
+void symgame::othersDistribution(std::vector<double> &probs, std::vector<int> &configs,
+                                 const cvector &s, int p1, int p2) const
+{
+  const int m = actions[0];
+  probs.assign(1, 1.0);
+  configs.assign(m, 0);
+  std::vector<double> nextProbs;
+  std::vector<int> nextConfigs, counts(m);
+  for (int n = 0, count = 0; n < numPlayers; n++) {
+    if (n == p1 || n == p2) {
+      continue;
+    }
+    // the number of configurations of count + 1 players is
+    // C(count + m, m - 1) = C(count + m - 1, m - 1) * (count + m) / (count + 1)
+    const size_t size = probs.size() * (count + m) / (count + 1);
+    count++;
+    nextProbs.assign(size, 0.0);
+    nextConfigs.assign(size * m, 0);
+    for (size_t c = 0; c < probs.size(); c++) {
+      for (int i = 0; i < m; i++) {
+        std::copy(&configs[c * m], &configs[c * m] + m, counts.begin());
+        counts[i]++;
+        const size_t index = table->GetConfiguration(counts);
+        nextProbs[index] += probs[c] * s[firstAction(n) + i];
+        std::copy(counts.cbegin(), counts.cend(), &nextConfigs[index * m]);
+      }
+    }
+    probs.swap(nextProbs);
+    configs.swap(nextConfigs);
+  }
+}
+
+void symgame::getPayoffVector(cvector &dest, int player, const cvector &s) const
+{
+  std::vector<double> probs;
+  std::vector<int> configs;
+  othersDistribution(probs, configs, s, player, -1);
+  for (int i = 0; i < actions[player]; i++) {
+    double total = 0.0;
+    for (size_t c = 0; c < probs.size(); c++) {
+      total += probs[c] * table->GetPayoff(i, c);
+    }
+    dest[i] = scale * (total - offset);
+  }
+}
+
+void symgame::payoffMatrix(cmatrix &dest, const cvector &s, double fuzz) const
+{
+  const int m = actions[0];
+  std::vector<double> probs;
+  std::vector<int> configs, counts(m);
+  for (int rown = 0; rown < numPlayers; rown++) {
+    double fuzzcount = fuzz;
+    for (int rowi = firstAction(rown); rowi < lastAction(rown); rowi++) {
+      for (int coli = firstAction(rown); coli < lastAction(rown); coli++) {
+        dest(rowi, coli) = fuzzcount;
+        fuzzcount += fuzz;
+      }
+    }
+    for (int coln = 0; coln < numPlayers; coln++) {
+      if (coln == rown) {
+        continue;
+      }
+      othersDistribution(probs, configs, s, rown, coln);
+      for (int coli = 0; coli < m; coli++) {
+        for (int rowi = 0; rowi < m; rowi++) {
+          dest(firstAction(rown) + rowi, firstAction(coln) + coli) = 0.0;
+        }
+        for (size_t c = 0; c < probs.size(); c++) {
+          std::copy(&configs[c * m], &configs[c * m] + m, counts.begin());
+          counts[coli]++;
+          const size_t config = table->GetConfiguration(counts);
+          for (int rowi = 0; rowi < m; rowi++) {
+            dest(firstAction(rown) + rowi, firstAction(coln) + coli) +=
+                probs[c] * payoff(rowi, config);
+          }
+        }
+      }
+    }
+  }
+}
+
+void symgame::KSymPayoffMatrix(cmatrix &dest, const cvector &s, double fuzz) const
+{
+  const int m = actions[0];
+  Vector<double> probs(m), values(m);
+  std::vector<double> derivs;
+  std::copy(s.values(), s.values() + m, probs.begin());
+  table->GetPayoffDerivs(probs, values, derivs);
+  // The derivatives are N-1 times the payoffs against one other player's
+  // action, so the offset is scaled in the same way.
+  const double others = numPlayers - 1;
+  double fuzzcount = fuzz;
+  for (int rowi = 0; rowi < m; rowi++) {
+    for (int coli = 0; coli < m; coli++) {
+      dest(rowi, coli) = scale * (derivs[rowi * m + coli] - others * offset);
+    }
+    dest(rowi, rowi) += fuzzcount;
+    fuzzcount += fuzz;
+  }
+}
+
+} // namespace gametracer
+} // end namespace Gambit
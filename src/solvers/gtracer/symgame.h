@@ -0,0 +1,98 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/solvers/gtracer/symgame.h
+// Interface to GNM-specific routines for symmetric strategic games
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_GTRACER_SYMGAME_H
+#define GAMBIT_GTRACER_SYMGAME_H
+
+#include <memory>
+#include "cmatrix.h"
+#include "gnmgame.h"
+#include "gambit.h"
+#include "games/stratsym.h"
+
+namespace Gambit {
+namespace gametracer {
+
+// A symmetric game, stored with one payoff for each action of a player and
+// configuration of the other players' actions.  All players form a single
+// player class, so the k-symmetric versions of the payoff computations work
+// with a single mixed strategy of length getNumActions(0); these are the
+// computations for which this representation is intended.  The computations
+// on general profiles are carried out by building up the distribution of
+// the configuration of the other players, one player at a time.
+//
+// Payoffs are those of the table, transformed to scale * (payoff - offset).
+class symgame : public gnmgame {
+public:
+  symgame(const std::shared_ptr<const SymmetricPayoffTable<double>> &p_table, double p_offset,
+          double p_scale);
+
+  ~symgame() override = default;
+
+  double getPurePayoff(int player, const std::vector<int> &s) const override;
+
+  void setPurePayoff(int player, const std::vector<int> &s, double value) override
+  {
+    throw Gambit::UndefinedException();
+  }
+
+  double getMixedPayoff(int player, const cvector &s) const override;
+
+  double getSymMixedPayoff(const cvector &s) override;
+
+  void payoffMatrix(cmatrix &dest, const cvector &s, double fuzz) const override;
+
+  void payoffMatrix(cmatrix &dest, const cvector &s, double fuzz, bool ksym) const override
+  {
+    return (ksym) ? KSymPayoffMatrix(dest, s, fuzz) : payoffMatrix(dest, s, fuzz);
+  }
+
+  void KSymPayoffMatrix(cmatrix &dest, const cvector &s, double fuzz) const;
+
+  void getPayoffVector(cvector &dest, int player, const cvector &s) const override;
+
+  int getNumPlayerClasses() const override { return 1; }
+  int getPlayerClass(int player) const override { return 0; }
+  int getNumKSymActions(int p) const override { return actions[0]; }
+  int firstKSymAction(int p) const override { return 0; }
+  int lastKSymAction(int p) const override { return actions[0]; }
+
+private:
+  std::shared_ptr<const SymmetricPayoffTable<double>> table;
+  double offset, scale;
+
+  double payoff(int action, size_t config) const
+  {
+    return scale * (table->GetPayoff(action, config) - offset);
+  }
+
+  // Computes the probability of each configuration of the actions of the
+  // players other than p1 and p2, under the profile s.  The configurations
+  // are indexed as in the table, and their counts are stored in configs.
+  void othersDistribution(std::vector<double> &probs, std::vector<int> &configs,
+                          const cvector &s, int p1, int p2) const;
+};
+
+} // namespace gametracer
+} // end namespace Gambit
+
+#endif // GAMBIT_GTRACER_SYMGAME_H
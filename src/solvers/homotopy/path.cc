@@ -2,7 +2,7 @@
 // This file is part of Gambit
 // Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
 //
-// FILE: src/tools/logit/path.cc
+// FILE: src/solvers/homotopy/path.cc
 // Implementation of generic smooth path-following algorithm.
 //
 // This program is free software; you can redistribute it and/or modify
@@ -22,6 +22,7 @@
 
 #include <cmath>
 #include <algorithm> // for std::max
+#include <chrono>
 
 #include "gambit.h"
 #include "core/sqmatrix.h"
@@ -35,34 +36,35 @@ namespace Gambit {
 
 namespace {
 
-inline double sqr(double x) { return x * x; }
+template <class T> inline T sqr(T x) { return x * x; }
 
-void Givens(Matrix<double> &b, Matrix<double> &q, double &c1, double &c2, int l1, int l2, int l3)
+template <class T>
+void Givens(Matrix<T> &b, Matrix<T> &q, T &c1, T &c2, int l1, int l2, int l3)
 {
-  if (fabs(c1) + fabs(c2) == 0.0) {
+  if (std::abs(c1) + std::abs(c2) == 0.0) {
     return;
   }
 
-  double sn;
-  if (fabs(c2) >= fabs(c1)) {
-    sn = std::sqrt(1.0 + sqr(c1 / c2)) * fabs(c2);
+  T sn;
+  if (std::abs(c2) >= std::abs(c1)) {
+    sn = std::sqrt(1.0 + sqr(c1 / c2)) * std::abs(c2);
   }
   else {
-    sn = std::sqrt(1.0 + sqr(c2 / c1)) * fabs(c1);
+    sn = std::sqrt(1.0 + sqr(c2 / c1)) * std::abs(c1);
   }
-  double s1 = c1 / sn;
-  double s2 = c2 / sn;
+  T s1 = c1 / sn;
+  T s2 = c2 / sn;
 
   for (int k = 1; k <= q.NumColumns(); k++) {
-    double sv1 = q(l1, k);
-    double sv2 = q(l2, k);
+    T sv1 = q(l1, k);
+    T sv2 = q(l2, k);
     q(l1, k) = s1 * sv1 + s2 * sv2;
     q(l2, k) = -s2 * sv1 + s1 * sv2;
   }
 
   for (int k = l3; k <= b.NumColumns(); k++) {
-    double sv1 = b(l1, k);
-    double sv2 = b(l2, k);
+    T sv1 = b(l1, k);
+    T sv2 = b(l2, k);
     b(l1, k) = s1 * sv1 + s2 * sv2;
     b(l2, k) = -s2 * sv1 + s1 * sv2;
   }
@@ -71,7 +73,7 @@ void Givens(Matrix<double> &b, Matrix<double> &q, double &c1, double &c2, int l1
   c2 = 0.0;
 }
 
-void QRDecomp(Matrix<double> &b, Matrix<double> &q)
+template <class T> void QRDecomp(Matrix<T> &b, Matrix<T> &q)
 {
   q.MakeIdent();
   for (int m = 1; m <= b.NumColumns(); m++) {
@@ -81,8 +83,8 @@ void QRDecomp(Matrix<double> &b, Matrix<double> &q)
   }
 }
 
-void NewtonStep(Matrix<double> &q, Matrix<double> &b, Vector<double> &u, Vector<double> &y,
-                double &d)
+template <class T>
+void NewtonStep(Matrix<T> &q, Matrix<T> &b, Vector<T> &u, Vector<T> &y, T &d)
 {
   for (int k = 1; k <= b.NumColumns(); k++) {
     for (int l = 1; l <= k - 1; l++) {
@@ -93,7 +95,7 @@ void NewtonStep(Matrix<double> &q, Matrix<double> &b, Vector<double> &u, Vector<
 
   d = 0.0;
   for (int k = 1; k <= b.NumRows(); k++) {
-    double s = 0.0;
+    T s = 0.0;
     for (int l = 1; l <= b.NumColumns(); l++) {
       s += q(l, k) * y[l];
     }
@@ -118,34 +120,37 @@ void NewtonStep(Matrix<double> &q, Matrix<double> &b, Vector<double> &u, Vector<
 // bifurcation point that the tracing gets stuck there as it is not possible
 // to find a small enough step size to avoid stepping over the bifurcation
 // point.
-void PathTracer::TracePath(
-    std::function<void(const Vector<double> &, Vector<double> &)> p_function,
-    std::function<void(const Vector<double> &, Matrix<double> &)> p_jacobian, Vector<double> &x,
-    double &p_omega, TerminationFunctionType p_terminate, CallbackFunctionType p_callback,
-    CriterionFunctionType p_criterion, CriterionBracketFunctionType p_criterionBracket) const
+template <class T>
+PathTracerStatus PathTracer<T>::TracePath(
+    std::function<void(const Vector<T> &, Vector<T> &)> p_function,
+    std::function<void(const Vector<T> &, Matrix<T> &)> p_jacobian, Vector<T> &x,
+    double &p_omega, TerminationFunctionType<T> p_terminate, CallbackFunctionType<T> p_callback,
+    CriterionFunctionType<T> p_criterion, CriterionBracketFunctionType<T> p_criterionBracket)
 {
-  const double c_tol = 1.0e-4;   // tolerance for corrector iteration
-  const double c_maxDist = 0.4;  // maximal distance to curve
-  const double c_maxContr = 0.6; // maximal contraction rate in corrector
-  const double c_eta = 0.1;      // perturbation to avoid cancellation
-                                 // in calculating contraction rate
-  double h = m_hStart;           // initial stepsize
-  const double c_hmin = 1.0e-8;  // minimal stepsize
-  const int c_maxIter = 100;     // maximum iterations in corrector
-
-  bool newton = false;             // using Newton steplength (for zero-finding)
-  const double c_pert = 0.0000001; // The size of perturbation to apply to avoid bifurcation traps
-  double pert = 0.0;               // The current version of the perturbation being applied
-  double pert_countdown = 0.0;     // How much longer (in arclength) to apply perturbation
-
-  Vector<double> u(x.size());
+  const T c_tol = 1.0e-4;   // tolerance for corrector iteration
+  const T c_maxDist = 0.4;  // maximal distance to curve
+  const T c_maxContr = 0.6; // maximal contraction rate in corrector
+  const T c_eta = 0.1;      // perturbation to avoid cancellation
+                            // in calculating contraction rate
+  T h = m_hStart;           // initial stepsize
+  const T c_hmin = m_hMin;  // minimal stepsize
+  const int c_maxIter = 100; // maximum iterations in corrector
+
+  bool newton = false;        // using Newton steplength (for zero-finding)
+  const T c_pert = 0.0000001; // The size of perturbation to apply to avoid bifurcation traps
+  T pert = 0.0;               // The current version of the perturbation being applied
+  T pert_countdown = 0.0;     // How much longer (in arclength) to apply perturbation
+
+  Vector<T> u(x.size());
   // t is current tangent at x; newT is tangent at u, which is the next point.
-  Vector<double> t(x.size()), newT(x.size());
-  Vector<double> y(x.size() - 1);
-  Matrix<double> b(x.size(), x.size() - 1);
-  SquareMatrix<double> q(x.size());
+  Vector<T> t(x.size()), newT(x.size());
+  Vector<T> y(x.size() - 1);
+  Matrix<T> b(x.size(), x.size() - 1);
+  SquareMatrix<T> q(x.size());
 
+  m_statistics = PathTracerStatistics();
   p_jacobian(x, b);
+  m_statistics.m_jacobianEvaluations++;
   QRDecomp(b, q);
   q.GetRow(q.NumRows(), t);
   p_callback(x);
@@ -153,8 +158,8 @@ void PathTracer::TracePath(
   while (!p_terminate(x)) {
     bool accept = true;
 
-    if (fabs(h) <= c_hmin) {
-      return;
+    if (std::abs(h) <= c_hmin) {
+      return PathTracerStatus::StepsizeLimit;
     }
 
     // Predictor step
@@ -162,32 +167,46 @@ void PathTracer::TracePath(
       u[k] = x[k] + h * p_omega * t[k];
     }
 
-    double decel = 1.0 / m_maxDecel; // initialize deceleration factor
+    PathTracerStep step;
+    step.m_stepsize = static_cast<double>(h);
+    step.m_perturbed = (pert != 0.0);
+
+    T decel = 1.0 / m_maxDecel; // initialize deceleration factor
+    auto start = std::chrono::steady_clock::now();
     p_jacobian(u, b);
+    m_statistics.m_jacobianEvaluations++;
     QRDecomp(b, q);
+    step.m_jacobianTime =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 
     int iter = 1;
-    double disto = 0.0;
+    T disto = 0.0;
     while (true) {
-      double dist;
+      T dist;
 
       p_function(u, y);
       y[1] += pert;
       NewtonStep(q, b, u, y, dist);
+      m_statistics.m_correctorIterations++;
+      step.m_iterations = iter;
+      step.m_distance = static_cast<double>(dist);
 
       if (dist >= c_maxDist) {
         accept = false;
+        step.m_result = PathTracerStepResult::RejectedDistance;
         break;
       }
 
-      decel = std::max(decel, std::sqrt(dist / c_maxDist) * m_maxDecel);
+      decel = std::max(decel, std::sqrt(dist / c_maxDist) * static_cast<T>(m_maxDecel));
       if (iter >= 2) {
-        double contr = dist / (disto + c_tol * c_eta);
+        T contr = dist / (disto + c_tol * c_eta);
+        step.m_contraction = static_cast<double>(contr);
         if (contr > c_maxContr) {
           accept = false;
+          step.m_result = PathTracerStepResult::RejectedContraction;
           break;
         }
-        decel = std::max(decel, std::sqrt(contr / c_maxContr) * m_maxDecel);
+        decel = std::max(decel, std::sqrt(contr / c_maxContr) * static_cast<T>(m_maxDecel));
       }
 
       if (dist <= c_tol) {
@@ -197,10 +216,17 @@ void PathTracer::TracePath(
       disto = dist;
       iter++;
       if (iter > c_maxIter) {
-        return;
+        step.m_result = PathTracerStepResult::CorrectorLimit;
+        step.m_parameter = static_cast<double>(u.back());
+        m_stepObserver(step);
+        return PathTracerStatus::CorrectorLimit;
       }
     }
 
+    if (!accept) {
+      m_statistics.m_rejections++;
+    }
+
     // Obtain the tangent at the next step
     q.GetRow(q.NumRows(), newT);
     double omega_flip = (t * newT < 0.0) ? -1.0 : 1.0;
@@ -211,21 +237,28 @@ void PathTracer::TracePath(
       // is oriented in the same direction as we were originally following
       if (pert_countdown == 0.0) {
         pert = c_pert;
-        pert_countdown = abs(2 * h);
+        pert_countdown = std::abs(2 * h);
+        m_statistics.m_perturbations++;
+      }
+      m_statistics.m_orientationFlips++;
+      if (accept) {
+        step.m_result = PathTracerStepResult::RejectedOrientation;
       }
       accept = false;
     }
 
     if (!accept) {
+      step.m_parameter = static_cast<double>(u.back());
+      m_stepObserver(step);
       h /= m_maxDecel; // PC not accepted; change stepsize and retry
-      if (fabs(h) <= c_hmin) {
-        return;
+      if (std::abs(h) <= c_hmin) {
+        return PathTracerStatus::StepsizeLimit;
       }
       continue;
     }
 
     // Determine new stepsize
-    decel = std::min(decel, m_maxDecel);
+    decel = std::min(decel, static_cast<T>(m_maxDecel));
 
     // If we are at a bifurcation point, the orientation of the tangent
     // will flip.  This will confuse many criterion functions, especially
@@ -243,24 +276,31 @@ void PathTracer::TracePath(
     }
     else {
       // Standard steplength adaptation
-      h = fabs(h / decel);
+      h = std::abs(h / decel);
     }
 
     // PC step was successful; update and iterate
     x = u;
     t = newT;
+    m_statistics.m_steps++;
+    step.m_parameter = static_cast<double>(x.back());
+    m_stepObserver(step);
     p_callback(x);
 
     if (pert_countdown > 0.0) {
       // If we are currently perturbing in the neighborhood of a bifurcation, check to see
       // whether we think we are likely past it, and switch off if we are.
-      pert_countdown -= abs(h);
+      pert_countdown -= std::abs(h);
       if (pert_countdown < 0.0) {
         pert = 0.0;
         pert_countdown = 0.0;
       }
     }
   }
+  return PathTracerStatus::Terminated;
 }
 
+template class PathTracer<double>;
+template class PathTracer<long double>;
+
 } // end namespace Gambit
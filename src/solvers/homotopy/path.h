@@ -0,0 +1,182 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/solvers/homotopy/path.h
+// Interface to generic smooth path-following algorithm.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_SOLVERS_HOMOTOPY_PATH_H
+#define GAMBIT_SOLVERS_HOMOTOPY_PATH_H
+
+#include <functional>
+
+namespace Gambit {
+
+// Function type used for determining whether to terminate the numerical continuation
+template <class T> using TerminationFunctionType = std::function<bool(const Vector<T> &)>;
+
+template <class T> inline bool LambdaPositiveTerminationFunction(const Vector<T> &p_point)
+{
+  return (p_point.back() < 0.0);
+}
+
+template <class T>
+inline bool LambdaRangeTerminationFunction(const Vector<T> &p_point, double p_minLambda,
+                                           double p_maxLambda)
+{
+  return (p_point.back() < p_minLambda || p_point.back() > p_maxLambda);
+}
+
+template <class T>
+using CriterionFunctionType = std::function<T(const Vector<T> &, const Vector<T> &)>;
+
+template <class T> inline T NullCriterionFunction(const Vector<T> &, const Vector<T> &)
+{
+  return -1.0;
+}
+
+template <class T>
+using CriterionBracketFunctionType = std::function<void(const Vector<T> &, const Vector<T> &)>;
+
+template <class T> inline void NullCriterionBracketFunction(const Vector<T> &, const Vector<T> &)
+{
+}
+
+template <class T> using CallbackFunctionType = std::function<void(const Vector<T> &)>;
+
+template <class T> inline void NullCallbackFunction(const Vector<T> &) {}
+
+/// The reason for which path-following stopped
+enum class PathTracerStatus {
+  /// The termination function was satisfied
+  Terminated,
+  /// No step of at least the minimum stepsize could be accepted
+  StepsizeLimit,
+  /// The corrector failed to converge within the maximum number of iterations
+  CorrectorLimit
+};
+
+/// Counts of the work done by the path-follower in tracing a path
+struct PathTracerStatistics {
+  /// Number of predictor-corrector steps accepted
+  int m_steps{0};
+  /// Number of steps rejected because the corrector diverged or contracted too slowly
+  int m_rejections{0};
+  /// Number of steps rejected because the orientation of the path changed
+  int m_orientationFlips{0};
+  /// Number of times a perturbation was applied to pass an apparent bifurcation
+  int m_perturbations{0};
+  /// Total number of corrector (Newton) iterations performed
+  int m_correctorIterations{0};
+  /// Total number of evaluations of the Jacobian
+  int m_jacobianEvaluations{0};
+};
+
+/// The outcome of an attempted predictor-corrector step
+enum class PathTracerStepResult {
+  /// The step was accepted
+  Accepted,
+  /// The corrector moved too far from the predicted point
+  RejectedDistance,
+  /// The corrector converged too slowly
+  RejectedContraction,
+  /// The orientation of the path changed, indicating a bifurcation
+  RejectedOrientation,
+  /// The corrector failed to converge within the maximum number of iterations
+  CorrectorLimit
+};
+
+/// Telemetry on one attempted predictor-corrector step
+struct PathTracerStep {
+  PathTracerStepResult m_result{PathTracerStepResult::Accepted};
+  /// The arclength of the predictor step
+  double m_stepsize{0.0};
+  /// The homotopy parameter at the corrected point if accepted, else at the predicted point
+  double m_parameter{0.0};
+  /// The number of corrector iterations performed
+  int m_iterations{0};
+  /// The length of the last corrector step
+  double m_distance{0.0};
+  /// The ratio of the lengths of the last two corrector steps (zero if only one was taken)
+  double m_contraction{0.0};
+  /// Whether a perturbation to pass an apparent bifurcation was in effect
+  bool m_perturbed{false};
+  /// Time, in seconds, spent evaluating the Jacobian and computing its QR decomposition
+  double m_jacobianTime{0.0};
+};
+
+using StepObserverFunctionType = std::function<void(const PathTracerStep &)>;
+
+inline void NullStepObserver(const PathTracerStep &) {}
+
+//
+// This class implements a generic path-following algorithm for smooth curves.
+// It is based on the ideas and codes presented in Allgower and Georg's
+// _Numerical Continuation Methods_.
+//
+// The class is parametrised by the scalar type used for the computation.
+// Instantiations are provided for double and long double; the latter is
+// useful for continuing a path when the steps taken in double precision
+// become too small to make progress.
+//
+// The tracer knows nothing about the system being followed beyond the
+// function and Jacobian supplied to TracePath, and is shared by all the
+// smooth homotopy methods (for example, the logit QRE correspondence and
+// the linear tracing procedure).  The last coordinate of the point is by
+// convention the homotopy parameter.  Counts of the steps taken and
+// rejected in the most recent call to TracePath are available from
+// GetStatistics(); a step observer, if set, is passed the details of each
+// step as it is attempted.
+//
+template <class T> class PathTracer {
+public:
+  PathTracer() : m_maxDecel(1.1), m_hStart(0.03), m_hMin(1.0e-8) {}
+  virtual ~PathTracer() = default;
+
+  void SetMaxDecel(double p_maxDecel) { m_maxDecel = p_maxDecel; }
+  double GetMaxDecel() const { return m_maxDecel; }
+
+  void SetStepsize(double p_hStart) { m_hStart = p_hStart; }
+  double GetStepsize() const { return m_hStart; }
+
+  void SetMinStepsize(double p_hMin) { m_hMin = p_hMin; }
+  double GetMinStepsize() const { return m_hMin; }
+
+  void SetStepObserver(StepObserverFunctionType p_observer) { m_stepObserver = p_observer; }
+
+  PathTracerStatus
+  TracePath(std::function<void(const Vector<T> &, Vector<T> &)> p_function,
+            std::function<void(const Vector<T> &, Matrix<T> &)> p_jacobian, Vector<T> &p_x,
+            double &p_omega, TerminationFunctionType<T> p_terminate,
+            CallbackFunctionType<T> p_callback = NullCallbackFunction<T>,
+            CriterionFunctionType<T> p_criterion = NullCriterionFunction<T>,
+            CriterionBracketFunctionType<T> p_criterionBracket =
+                NullCriterionBracketFunction<T>);
+
+  /// Returns the counts of work done in the most recent call to TracePath
+  const PathTracerStatistics &GetStatistics() const { return m_statistics; }
+
+private:
+  double m_maxDecel, m_hStart, m_hMin;
+  PathTracerStatistics m_statistics;
+  StepObserverFunctionType m_stepObserver{NullStepObserver};
+};
+
+} // end namespace Gambit
+
+#endif // GAMBIT_SOLVERS_HOMOTOPY_PATH_H
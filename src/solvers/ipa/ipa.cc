@@ -69,5 +69,32 @@ List<MixedStrategyProfile<double>> IPAStrategySolve(const MixedStrategyProfile<d
   return solutions;
 }
 
+List<MixedStrategyProfile<double>>
+IPASymmetricStrategySolve(const MixedStrategyProfile<double> &p_pert,
+                          StrategyCallbackType p_callback)
+{
+  if (!p_pert.GetGame()->IsPerfectRecall()) {
+    throw UndefinedException(
+        "Computing equilibria of games with imperfect recall is not supported.");
+  }
+
+  std::shared_ptr<gnmgame> A = BuildSymmetricGame(p_pert.GetGame(), false);
+  cvector g(ToKSymPerturbation(*A, p_pert));
+  cvector ans(A->getNumKSymActions());
+  cvector zh(A->getNumKSymActions(), 1.0);
+  while (true) {
+    const double ALPHA = 0.2;
+    const double EQERR = 1e-6;
+    if (IPA(*A, g, zh, ALPHA, EQERR, ans, 100, false, true)) {
+      break;
+    }
+  }
+
+  List<MixedStrategyProfile<double>> solutions;
+  solutions.push_back(ToKSymProfile(p_pert.GetGame(), *A, ans));
+  p_callback(solutions.back(), "NE");
+  return solutions;
+}
+
 } // namespace Nash
 } // namespace Gambit
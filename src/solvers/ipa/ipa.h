@@ -35,6 +35,15 @@ List<MixedStrategyProfile<double>>
 IPAStrategySolve(const MixedStrategyProfile<double> &p_pert,
                  StrategyCallbackType p_callback = NullStrategyCallback);
 
+/// @brief Compute a symmetric equilibrium, working with the strategy of one player
+/// @details For action graph games, the equilibrium computed is k-symmetric: players
+///          with the same set of actions play the same strategy.
+/// @exception UndefinedException  If the game is not symmetric, and is not an action
+///                                graph game
+List<MixedStrategyProfile<double>>
+IPASymmetricStrategySolve(const MixedStrategyProfile<double> &p_pert,
+                          StrategyCallbackType p_callback = NullStrategyCallback);
+
 } // namespace Nash
 } // namespace Gambit
 
@@ -26,7 +26,7 @@
 #include "gambit.h"
 #include "logit.h"
 #include "logbehav.imp"
-#include "path.h"
+#include "solvers/homotopy/path.h"
 
 namespace {
 
@@ -317,11 +317,13 @@ namespace Gambit {
 List<LogitQREMixedBehaviorProfile> LogitBehaviorSolve(const LogitQREMixedBehaviorProfile &p_start,
                                                       double p_regret, double p_omega,
                                                       double p_firstStep, double p_maxAccel,
-                                                      MixedBehaviorObserverFunctionType p_observer)
+                                                      MixedBehaviorObserverFunctionType p_observer,
+                                                      StepObserverFunctionType p_stepObserver)
 {
-  PathTracer tracer;
+  PathTracer<double> tracer;
   tracer.SetMaxDecel(p_maxAccel);
   tracer.SetStepsize(p_firstStep);
+  tracer.SetStepObserver(p_stepObserver);
 
   double scale = p_start.GetGame()->GetMaxPayoff() - p_start.GetGame()->GetMinPayoff();
   if (scale != 0.0) {
@@ -351,11 +353,13 @@ std::list<LogitQREMixedBehaviorProfile>
 LogitBehaviorSolveLambda(const LogitQREMixedBehaviorProfile &p_start,
                          const std::list<double> &p_targetLambda, double p_omega,
                          double p_firstStep, double p_maxAccel,
-                         MixedBehaviorObserverFunctionType p_observer)
+                         MixedBehaviorObserverFunctionType p_observer,
+                         StepObserverFunctionType p_stepObserver)
 {
-  PathTracer tracer;
+  PathTracer<double> tracer;
   tracer.SetMaxDecel(p_maxAccel);
   tracer.SetStepsize(p_firstStep);
+  tracer.SetStepObserver(p_stepObserver);
 
   Game game = p_start.GetGame();
   Vector<double> x(ProfileToPoint(p_start));
@@ -370,7 +374,7 @@ LogitBehaviorSolveLambda(const LogitQREMixedBehaviorProfile &p_start,
         [&system](const Vector<double> &p_point, Matrix<double> &p_jac) {
           system.GetJacobian(p_point, p_jac);
         },
-        x, p_omega, LambdaPositiveTerminationFunction,
+        x, p_omega, LambdaPositiveTerminationFunction<double>,
         [&callback](const Vector<double> &p_point) -> void { callback.AppendPoint(p_point); },
         [lam](const Vector<double> &x, const Vector<double> &) -> double {
           return x.back() - lam;
@@ -386,7 +390,7 @@ LogitBehaviorEstimate(const MixedBehaviorProfile<double> &p_frequencies, double
                       MixedBehaviorObserverFunctionType p_observer)
 {
   LogitQREMixedBehaviorProfile start(p_frequencies.GetGame());
-  PathTracer tracer;
+  PathTracer<double> tracer;
   tracer.SetMaxDecel(p_maxAccel);
   tracer.SetStepsize(p_firstStep);
 
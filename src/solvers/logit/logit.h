@@ -24,6 +24,7 @@
 #define SOLVERS_LOGIT_H
 
 #include <functional>
+#include "solvers/homotopy/path.h"
 
 namespace Gambit {
 
@@ -87,13 +88,25 @@ inline void NullMixedStrategyObserver(const LogitQREMixedStrategyProfile &) {}
 List<LogitQREMixedStrategyProfile>
 LogitStrategySolve(const LogitQREMixedStrategyProfile &p_start, double p_regret, double p_omega,
                    double p_firstStep, double p_maxAccel,
-                   MixedStrategyObserverFunctionType p_observer = NullMixedStrategyObserver);
+                   MixedStrategyObserverFunctionType p_observer = NullMixedStrategyObserver,
+                   StepObserverFunctionType p_stepObserver = NullStepObserver);
+
+/// Traces the branch of symmetric logit equilibria of a symmetric game, starting
+/// from the symmetric profile p_start, which is given for all players.  The
+/// branch is traced in the space of the strategies of a single player.
+/// @exception UndefinedException  If the game is not symmetric
+List<LogitQREMixedStrategyProfile> LogitSymmetricStrategySolve(
+    const LogitQREMixedStrategyProfile &p_start, double p_regret, double p_omega,
+    double p_firstStep, double p_maxAccel,
+    MixedStrategyObserverFunctionType p_observer = NullMixedStrategyObserver,
+    StepObserverFunctionType p_stepObserver = NullStepObserver);
 
 std::list<LogitQREMixedStrategyProfile>
 LogitStrategySolveLambda(const LogitQREMixedStrategyProfile &p_start,
                          const std::list<double> &p_targetLambda, double p_omega,
                          double p_firstStep, double p_maxAccel,
-                         MixedStrategyObserverFunctionType p_observer = NullMixedStrategyObserver);
+                         MixedStrategyObserverFunctionType p_observer = NullMixedStrategyObserver,
+                         StepObserverFunctionType p_stepObserver = NullStepObserver);
 
 LogitQREMixedStrategyProfile
 LogitStrategyEstimate(const MixedStrategyProfile<double> &p_frequencies, double p_maxLambda,
@@ -110,13 +123,15 @@ inline void NullMixedBehaviorObserver(const LogitQREMixedBehaviorProfile &) {}
 List<LogitQREMixedBehaviorProfile>
 LogitBehaviorSolve(const LogitQREMixedBehaviorProfile &p_start, double p_regret, double p_omega,
                    double p_firstStep, double p_maxAccel,
-                   MixedBehaviorObserverFunctionType p_observer = NullMixedBehaviorObserver);
+                   MixedBehaviorObserverFunctionType p_observer = NullMixedBehaviorObserver,
+                   StepObserverFunctionType p_stepObserver = NullStepObserver);
 
 std::list<LogitQREMixedBehaviorProfile>
 LogitBehaviorSolveLambda(const LogitQREMixedBehaviorProfile &p_start,
                          const std::list<double> &p_targetLambda, double p_omega,
                          double p_firstStep, double p_maxAccel,
-                         MixedBehaviorObserverFunctionType p_observer = NullMixedBehaviorObserver);
+                         MixedBehaviorObserverFunctionType p_observer = NullMixedBehaviorObserver,
+                         StepObserverFunctionType p_stepObserver = NullStepObserver);
 
 LogitQREMixedBehaviorProfile
 LogitBehaviorEstimate(const MixedBehaviorProfile<double> &p_frequencies, double p_maxLambda,
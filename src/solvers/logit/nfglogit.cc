@@ -24,22 +24,36 @@
 #include <cmath>
 
 #include "gambit.h"
+#include "games/strattensor.h"
+#include "games/stratsym.h"
 #include "logit.h"
-#include "path.h"
+#include "solvers/homotopy/path.h"
 
 namespace Gambit {
 
 namespace {
 
-MixedStrategyProfile<double> PointToProfile(const Game &p_game, const Vector<double> &p_point)
+template <class T>
+MixedStrategyProfile<double> PointToProfile(const Game &p_game, const Vector<T> &p_point)
 {
   MixedStrategyProfile<double> profile(p_game->NewMixedStrategyProfile(0.0));
   for (int i = 1; i < p_point.size(); i++) {
-    profile[i] = exp(p_point[i]);
+    profile[i] = static_cast<double>(std::exp(p_point[i]));
   }
   return profile;
 }
 
+template <class T>
+MixedStrategyProfile<double> SymmetricPointToProfile(const Game &p_game,
+                                                     const Vector<T> &p_point)
+{
+  Vector<double> probs(p_point.size() - 1);
+  for (int i = 1; i < p_point.size(); i++) {
+    probs[i] = static_cast<double>(std::exp(p_point[i]));
+  }
+  return SymmetricProfile(p_game, probs);
+}
+
 Vector<double> ProfileToPoint(const LogitQREMixedStrategyProfile &p_profile)
 {
   Vector<double> point(p_profile.size() + 1);
@@ -50,6 +64,19 @@ Vector<double> ProfileToPoint(const LogitQREMixedStrategyProfile &p_profile)
   return point;
 }
 
+// The point for a symmetric profile consists of the logarithms of the
+// probabilities of the strategies of the first player, and lambda
+Vector<double> SymmetricProfileToPoint(const LogitQREMixedStrategyProfile &p_profile)
+{
+  const GamePlayer player = p_profile.GetGame()->GetPlayer(1);
+  Vector<double> point(player->NumStrategies() + 1);
+  for (size_t i = 1; i <= player->NumStrategies(); i++) {
+    point[i] = log(p_profile.GetProfile()[player->GetStrategy(i)]);
+  }
+  point.back() = p_profile.GetLambda();
+  return point;
+}
+
 double LogLike(const Vector<double> &p_frequencies, const Vector<double> &p_point)
 {
   double logL = 0.0;
@@ -68,125 +95,362 @@ double DiffLogLike(const Vector<double> &p_frequencies, const Vector<double> &p_
   return diff_logL;
 }
 
-bool RegretTerminationFunction(const Game &p_game, const Vector<double> &p_point, double p_regret)
+//
+// This class evaluates the system of equations defining the logit
+// correspondence.  When the game is a table, strategy values and their
+// derivatives are computed in one pass over a dense copy of the payoffs;
+// otherwise they are obtained from a mixed strategy profile on the game.
+// Both are computed at most once per point, and the storage used is
+// allocated once and reused at each step of the path-following.
+//
+// The system may be evaluated in a wider floating-point type than double.
+// For games not in table form, payoffs are still evaluated in double.
+//
+template <class T> class EquationSystem {
+public:
+  explicit EquationSystem(const Game &p_game);
+  ~EquationSystem() = default;
+
+  // Compute the value of the system of equations at the specified point.
+  void GetValue(const Vector<T> &p_point, Vector<T> &p_lhs);
+
+  // Compute the Jacobian matrix at the specified point.
+  void GetJacobian(const Vector<T> &p_point, Matrix<T> &p_matrix);
+
+  // Compute the maximum regret of any player at the specified point.
+  T GetMaxRegret(const Vector<T> &p_point);
+
+private:
+  // Sets the probabilities to those at the point; returns true if they changed.
+  bool SetPoint(const Vector<T> &p_point);
+  void ComputeValues();
+  void ComputeDerivs();
+
+  Game m_game;
+  std::unique_ptr<StrategicPayoffTensor<T>> m_tensor;
+  MixedStrategyProfile<double> m_profile;
+  Array<GameStrategy> m_strategies;
+  // The first strategy index, and number of strategies, of each player
+  Array<int> m_first, m_size;
+  Vector<T> m_probs, m_values;
+  std::vector<T> m_derivs;
+  bool m_haveValues{false}, m_haveDerivs{false};
+};
+
+template <class T>
+EquationSystem<T>::EquationSystem(const Game &p_game)
+  : m_game(p_game), m_profile(p_game->NewMixedStrategyProfile(0.0)),
+    m_strategies(p_game->GetStrategies()), m_first(p_game->NumPlayers()),
+    m_size(p_game->NumPlayers()), m_probs(p_game->MixedProfileLength()),
+    m_values(p_game->MixedProfileLength()), m_derivs(m_probs.size() * m_probs.size())
 {
-  if (p_point.back() < 0.0) {
-    return true;
+  if (StrategicPayoffTensor<T>::IsTabulated(p_game)) {
+    m_tensor = std::make_unique<StrategicPayoffTensor<T>>(p_game);
+  }
+  for (int pl = 1, first = 1; pl <= p_game->NumPlayers(); pl++) {
+    m_first[pl] = first;
+    m_size[pl] = p_game->GetPlayer(pl)->NumStrategies();
+    first += m_size[pl];
   }
-  return PointToProfile(p_game, p_point).GetMaxRegret() < p_regret;
 }
 
-void GetValue(const Game &p_game, const Vector<double> &p_point, Vector<double> &p_lhs)
+template <class T> bool EquationSystem<T>::SetPoint(const Vector<T> &p_point)
 {
-  MixedStrategyProfile<double> profile(PointToProfile(p_game, p_point)),
-      logprofile(p_game->NewMixedStrategyProfile(0.0));
-  for (size_t i = 1; i <= profile.MixedProfileLength(); i++) {
-    logprofile[i] = p_point[i];
-  }
-  double lambda = p_point.back();
-  p_lhs = 0.0;
-  for (int rowno = 0, pl = 1; pl <= p_game->NumPlayers(); pl++) {
-    GamePlayer player = p_game->GetPlayer(pl);
-    for (size_t st = 1; st <= player->GetStrategies().size(); st++) {
-      rowno++;
-      if (st == 1) {
-        // This is a sum-to-one equation
-        p_lhs[rowno] = -1.0;
-        for (size_t j = 1; j <= player->GetStrategies().size(); j++) {
-          p_lhs[rowno] += profile[player->GetStrategy(j)];
-        }
-      }
-      else {
-        // This is a ratio equation
-        p_lhs[rowno] = (logprofile[player->GetStrategy(st)] - logprofile[player->GetStrategy(1)] -
-                        lambda * (profile.GetPayoff(player->GetStrategy(st)) -
-                                  profile.GetPayoff(player->GetStrategy(1))));
+  bool changed = false;
+  for (int i = 1; i <= m_probs.size(); i++) {
+    T prob = std::exp(p_point[i]);
+    if (prob != m_probs[i]) {
+      m_probs[i] = prob;
+      changed = true;
+    }
+  }
+  if (changed) {
+    m_haveValues = m_haveDerivs = false;
+  }
+  return changed;
+}
+
+template <class T> void EquationSystem<T>::ComputeValues()
+{
+  if (m_haveValues) {
+    return;
+  }
+  if (m_tensor) {
+    m_tensor->GetStrategyValues(m_probs, m_values);
+  }
+  else {
+    for (int i = 1; i <= m_probs.size(); i++) {
+      m_profile[i] = static_cast<double>(m_probs[i]);
+    }
+    for (int i = 1; i <= m_values.size(); i++) {
+      m_values[i] = m_profile.GetPayoff(m_strategies[i]);
+    }
+  }
+  m_haveValues = true;
+}
+
+template <class T> void EquationSystem<T>::ComputeDerivs()
+{
+  if (m_haveDerivs) {
+    return;
+  }
+  if (m_tensor) {
+    m_tensor->GetPayoffDerivs(m_probs, m_values, m_derivs);
+  }
+  else {
+    for (int i = 1; i <= m_probs.size(); i++) {
+      m_profile[i] = static_cast<double>(m_probs[i]);
+    }
+    const size_t n = m_values.size();
+    for (size_t i = 1; i <= n; i++) {
+      const GameStrategy &strategy = m_strategies[i];
+      GamePlayer player = strategy->GetPlayer();
+      m_values[i] = m_profile.GetPayoff(strategy);
+      for (size_t j = 1; j <= n; j++) {
+        m_derivs[(i - 1) * n + j - 1] =
+            (m_strategies[j]->GetPlayer() == player)
+                ? 0.0
+                : m_profile.GetPayoffDeriv(player->GetNumber(), strategy, m_strategies[j]);
       }
     }
   }
+  m_haveValues = m_haveDerivs = true;
 }
 
-void GetJacobian(const Game &p_game, const Vector<double> &p_point, Matrix<double> &p_matrix)
+template <class T> T EquationSystem<T>::GetMaxRegret(const Vector<T> &p_point)
 {
-  MixedStrategyProfile<double> profile(PointToProfile(p_game, p_point)),
-      logprofile(p_game->NewMixedStrategyProfile(0.0));
-  for (size_t i = 1; i <= profile.MixedProfileLength(); i++) {
-    logprofile[i] = p_point[i];
+  SetPoint(p_point);
+  ComputeValues();
+  T maxRegret = 0.0;
+  for (int pl = 1; pl <= m_first.size(); pl++) {
+    T best = m_values[m_first[pl]], payoff = 0.0;
+    for (int st = m_first[pl]; st < m_first[pl] + m_size[pl]; st++) {
+      best = std::max(best, m_values[st]);
+      payoff += m_probs[st] * m_values[st];
+    }
+    maxRegret = std::max(maxRegret, best - payoff);
   }
-  double lambda = p_point.back();
+  return maxRegret;
+}
 
-  p_matrix = 0.0;
+template <class T>
+void EquationSystem<T>::GetValue(const Vector<T> &p_point, Vector<T> &p_lhs)
+{
+  SetPoint(p_point);
+  ComputeValues();
+  T lambda = p_point.back();
+  for (int pl = 1; pl <= m_first.size(); pl++) {
+    const int first = m_first[pl];
+    // The first equation for each player is a sum-to-one equation,
+    // the remainder are ratio equations relative to the first strategy
+    p_lhs[first] = -1.0;
+    for (int st = first; st < first + m_size[pl]; st++) {
+      p_lhs[first] += m_probs[st];
+    }
+    for (int st = first + 1; st < first + m_size[pl]; st++) {
+      p_lhs[st] = (p_point[st] - p_point[first] - lambda * (m_values[st] - m_values[first]));
+    }
+  }
+}
+
+template <class T>
+void EquationSystem<T>::GetJacobian(const Vector<T> &p_point, Matrix<T> &p_matrix)
+{
+  SetPoint(p_point);
+  ComputeDerivs();
+  T lambda = p_point.back();
+  const size_t n = m_probs.size();
 
-  for (int rowno = 0, i = 1; i <= p_game->NumPlayers(); i++) {
-    GamePlayer player = p_game->GetPlayer(i);
-    for (size_t j = 1; j <= player->GetStrategies().size(); j++) {
-      rowno++;
-      if (j == 1) {
-        // This is a sum-to-one equation
-        for (int colno = 0, ell = 1; ell <= p_game->NumPlayers(); ell++) {
-          GamePlayer player2 = p_game->GetPlayer(ell);
-          for (size_t m = 1; m <= player2->GetStrategies().size(); m++) {
-            colno++;
-            if (i == ell) {
-              p_matrix(colno, rowno) = profile[player2->GetStrategy(m)];
-            }
-            // Otherwise, entry is zero
-          }
+  p_matrix = 0.0;
+  for (int pl = 1; pl <= m_first.size(); pl++) {
+    const int first = m_first[pl];
+    // The sum-to-one equation: derivatives wrt own strategies only,
+    // and the derivative wrt lambda is zero
+    for (int st = first; st < first + m_size[pl]; st++) {
+      p_matrix(st, first) = m_probs[st];
+    }
+    // The ratio equations
+    for (int st = first + 1; st < first + m_size[pl]; st++) {
+      const T *row = &m_derivs[(st - 1) * n];
+      const T *refRow = &m_derivs[(first - 1) * n];
+      for (int pl2 = 1; pl2 <= m_first.size(); pl2++) {
+        if (pl2 == pl) {
+          p_matrix(first, st) = -1.0;
+          p_matrix(st, st) = 1.0;
+          continue;
         }
-        // The last column is derivative wrt lambda, which is zero
-      }
-      else {
-        // This is a ratio equation
-        for (int colno = 0, ell = 1; ell <= p_game->NumPlayers(); ell++) {
-          GamePlayer player2 = p_game->GetPlayer(ell);
-          for (size_t m = 1; m <= player2->GetStrategies().size(); m++) {
-            colno++;
-            if (i == ell) {
-              if (m == 1) {
-                p_matrix(colno, rowno) = -1.0;
-              }
-              else if (m == j) {
-                p_matrix(colno, rowno) = 1.0;
-              }
-              // Entry is zero for all other strategy pairs
-            }
-            else {
-              p_matrix(colno, rowno) =
-                  -lambda * profile[player2->GetStrategy(m)] *
-                  (profile.GetPayoffDeriv(i, player->GetStrategy(j), player2->GetStrategy(m)) -
-                   profile.GetPayoffDeriv(i, player->GetStrategy(1), player2->GetStrategy(m)));
-            }
-          }
+        for (int st2 = m_first[pl2]; st2 < m_first[pl2] + m_size[pl2]; st2++) {
+          p_matrix(st2, st) = -lambda * m_probs[st2] * (row[st2 - 1] - refRow[st2 - 1]);
         }
-        // Fill the last column, the derivative wrt lambda
-        p_matrix(p_matrix.NumRows(), rowno) = (profile.GetPayoff(player->GetStrategy(1)) -
-                                               profile.GetPayoff(player->GetStrategy(j)));
       }
+      // The last row is the derivative wrt lambda
+      p_matrix(p_matrix.NumRows(), st) = m_values[first] - m_values[st];
+    }
+  }
+}
+
+//
+// This class evaluates the system of equations defining the branch of the
+// logit correspondence consisting of symmetric profiles, for a symmetric
+// game.  The unknowns are the logarithms of the probabilities of the
+// strategies of one player, and lambda; the system has one equation for
+// each strategy, in place of one for each strategy of each player.
+// Strategy values and their derivatives are computed from the payoffs
+// stored once for each configuration of the other players.
+//
+template <class T> class SymmetricEquationSystem {
+public:
+  explicit SymmetricEquationSystem(const Game &p_game);
+  ~SymmetricEquationSystem() = default;
+
+  // Compute the value of the system of equations at the specified point.
+  void GetValue(const Vector<T> &p_point, Vector<T> &p_lhs);
+
+  // Compute the Jacobian matrix at the specified point.
+  void GetJacobian(const Vector<T> &p_point, Matrix<T> &p_matrix);
+
+  // Compute the maximum regret of any player at the specified point.
+  T GetMaxRegret(const Vector<T> &p_point);
+
+private:
+  // Sets the probabilities to those at the point; returns true if they changed.
+  bool SetPoint(const Vector<T> &p_point);
+  void ComputeValues();
+  void ComputeDerivs();
+
+  SymmetricPayoffTable<T> m_table;
+  Vector<T> m_probs, m_values;
+  std::vector<T> m_derivs;
+  bool m_haveValues{false}, m_haveDerivs{false};
+};
+
+template <class T>
+SymmetricEquationSystem<T>::SymmetricEquationSystem(const Game &p_game)
+  : m_table(p_game), m_probs(m_table.NumStrategies()), m_values(m_table.NumStrategies())
+{
+}
+
+template <class T> bool SymmetricEquationSystem<T>::SetPoint(const Vector<T> &p_point)
+{
+  bool changed = false;
+  for (int i = 1; i <= m_probs.size(); i++) {
+    T prob = std::exp(p_point[i]);
+    if (prob != m_probs[i]) {
+      m_probs[i] = prob;
+      changed = true;
+    }
+  }
+  if (changed) {
+    m_haveValues = m_haveDerivs = false;
+  }
+  return changed;
+}
+
+template <class T> void SymmetricEquationSystem<T>::ComputeValues()
+{
+  if (!m_haveValues) {
+    m_table.GetStrategyValues(m_probs, m_values);
+    m_haveValues = true;
+  }
+}
+
+template <class T> void SymmetricEquationSystem<T>::ComputeDerivs()
+{
+  if (!m_haveDerivs) {
+    m_table.GetPayoffDerivs(m_probs, m_values, m_derivs);
+    m_haveValues = m_haveDerivs = true;
+  }
+}
+
+template <class T> T SymmetricEquationSystem<T>::GetMaxRegret(const Vector<T> &p_point)
+{
+  SetPoint(p_point);
+  ComputeValues();
+  T best = m_values[1], payoff = 0.0;
+  for (int st = 1; st <= m_probs.size(); st++) {
+    best = std::max(best, m_values[st]);
+    payoff += m_probs[st] * m_values[st];
+  }
+  return best - payoff;
+}
+
+template <class T>
+void SymmetricEquationSystem<T>::GetValue(const Vector<T> &p_point, Vector<T> &p_lhs)
+{
+  SetPoint(p_point);
+  ComputeValues();
+  T lambda = p_point.back();
+  p_lhs[1] = -1.0;
+  for (int st = 1; st <= m_probs.size(); st++) {
+    p_lhs[1] += m_probs[st];
+  }
+  for (int st = 2; st <= m_probs.size(); st++) {
+    p_lhs[st] = (p_point[st] - p_point[1] - lambda * (m_values[st] - m_values[1]));
+  }
+}
+
+template <class T>
+void SymmetricEquationSystem<T>::GetJacobian(const Vector<T> &p_point, Matrix<T> &p_matrix)
+{
+  SetPoint(p_point);
+  ComputeDerivs();
+  T lambda = p_point.back();
+  const int m = m_probs.size();
+
+  p_matrix = 0.0;
+  for (int st = 1; st <= m; st++) {
+    p_matrix(st, 1) = m_probs[st];
+  }
+  // The probabilities of the strategies of all the other players move
+  // together, so each ratio equation depends on lambda through the values,
+  // and on every log-probability through both the values and the ratio.
+  for (int st = 2; st <= m; st++) {
+    const T *row = &m_derivs[(st - 1) * m];
+    const T *refRow = &m_derivs[0];
+    for (int st2 = 1; st2 <= m; st2++) {
+      p_matrix(st2, st) = -lambda * m_probs[st2] * (row[st2 - 1] - refRow[st2 - 1]);
     }
+    p_matrix(1, st) -= 1.0;
+    p_matrix(st, st) += 1.0;
+    p_matrix(p_matrix.NumRows(), st) = m_values[1] - m_values[st];
   }
 }
 
+template <class T, class S>
+bool RegretTerminationFunction(S &p_system, const Vector<T> &p_point, double p_regret)
+{
+  if (p_point.back() < 0.0) {
+    return true;
+  }
+  return p_system.GetMaxRegret(p_point) < p_regret;
+}
+
 class TracingCallbackFunction {
 public:
-  TracingCallbackFunction(const Game &p_game, MixedStrategyObserverFunctionType p_observer)
-    : m_game(p_game), m_observer(p_observer)
+  TracingCallbackFunction(const Game &p_game, MixedStrategyObserverFunctionType p_observer,
+                          bool p_symmetric = false)
+    : m_game(p_game), m_observer(p_observer), m_symmetric(p_symmetric)
   {
   }
   ~TracingCallbackFunction() = default;
 
-  void AppendPoint(const Vector<double> &p_point);
+  template <class T> void AppendPoint(const Vector<T> &p_point);
   const List<LogitQREMixedStrategyProfile> &GetProfiles() const { return m_profiles; }
 
 private:
   Game m_game;
   MixedStrategyObserverFunctionType m_observer;
+  // If true, points hold the strategy of one player, which all players adopt
+  bool m_symmetric;
   List<LogitQREMixedStrategyProfile> m_profiles;
 };
 
-void TracingCallbackFunction::AppendPoint(const Vector<double> &p_point)
+template <class T> void TracingCallbackFunction::AppendPoint(const Vector<T> &p_point)
 {
-  MixedStrategyProfile<double> profile(PointToProfile(m_game, p_point));
-  m_profiles.push_back(LogitQREMixedStrategyProfile(profile, p_point.back(), 1.0));
+  MixedStrategyProfile<double> profile((m_symmetric) ? SymmetricPointToProfile(m_game, p_point)
+                                                     : PointToProfile(m_game, p_point));
+  m_profiles.push_back(
+      LogitQREMixedStrategyProfile(profile, static_cast<double>(p_point.back()), 1.0));
   m_observer(m_profiles.back());
 }
 
@@ -229,36 +493,87 @@ void EstimatorCallbackFunction::EvaluatePoint(const Vector<double> &p_point)
   }
 }
 
-} // namespace
+template <class T, class S>
+PathTracerStatus TraceRegretPath(PathTracer<T> &p_tracer, S &p_system, Vector<T> &p_x,
+                                 double &p_omega, double p_regret,
+                                 TracingCallbackFunction &p_callback)
+{
+  return p_tracer.TracePath(
+      [&p_system](const Vector<T> &p_point, Vector<T> &p_lhs) {
+        p_system.GetValue(p_point, p_lhs);
+      },
+      [&p_system](const Vector<T> &p_point, Matrix<T> &p_jac) {
+        p_system.GetJacobian(p_point, p_jac);
+      },
+      p_x, p_omega,
+      [&p_system, p_regret](const Vector<T> &p_point) {
+        return RegretTerminationFunction<T>(p_system, p_point, p_regret);
+      },
+      [&p_callback](const Vector<T> &p_point) -> void { p_callback.AppendPoint(p_point); });
+}
 
-List<LogitQREMixedStrategyProfile> LogitStrategySolve(const LogitQREMixedStrategyProfile &p_start,
-                                                      double p_regret, double p_omega,
-                                                      double p_firstStep, double p_maxAccel,
-                                                      MixedStrategyObserverFunctionType p_observer)
+// Traces the branch from p_x until a point with regret less than p_regret is
+// reached, using the equation system S.
+template <template <class> class S>
+void TraceToRegret(const Game &p_game, Vector<double> &p_x, double p_regret, double p_omega,
+                   double p_firstStep, double p_maxAccel, StepObserverFunctionType p_stepObserver,
+                   TracingCallbackFunction &p_callback)
 {
-  PathTracer tracer;
+  PathTracer<double> tracer;
   tracer.SetMaxDecel(p_maxAccel);
   tracer.SetStepsize(p_firstStep);
+  tracer.SetStepObserver(p_stepObserver);
 
-  double scale = p_start.GetGame()->GetMaxPayoff() - p_start.GetGame()->GetMinPayoff();
+  double scale = p_game->GetMaxPayoff() - p_game->GetMinPayoff();
   if (scale != 0.0) {
     p_regret *= scale;
   }
 
+  S<double> system(p_game);
+  if (TraceRegretPath(tracer, system, p_x, p_omega, p_regret, p_callback) !=
+      PathTracerStatus::StepsizeLimit) {
+    return;
+  }
+
+  // At large lambda, the probabilities of strategies which are not best responses
+  // become too small to represent accurately, and the steps the tracer is able to
+  // take shrink until it stalls.  Continue from the last point reached using
+  // extended precision.
+  PathTracer<long double> extTracer;
+  extTracer.SetMaxDecel(p_maxAccel);
+  extTracer.SetStepsize(p_firstStep);
+  extTracer.SetStepObserver(p_stepObserver);
+  S<long double> extSystem(p_game);
+  Vector<long double> extX(p_x.size());
+  std::copy(p_x.begin(), p_x.end(), extX.begin());
+  TraceRegretPath(extTracer, extSystem, extX, p_omega, p_regret, p_callback);
+}
+
+} // namespace
+
+List<LogitQREMixedStrategyProfile> LogitStrategySolve(const LogitQREMixedStrategyProfile &p_start,
+                                                      double p_regret, double p_omega,
+                                                      double p_firstStep, double p_maxAccel,
+                                                      MixedStrategyObserverFunctionType p_observer,
+                                                      StepObserverFunctionType p_stepObserver)
+{
   Vector<double> x(ProfileToPoint(p_start));
   TracingCallbackFunction callback(p_start.GetGame(), p_observer);
-  tracer.TracePath(
-      [&p_start](const Vector<double> &p_point, Vector<double> &p_lhs) {
-        GetValue(p_start.GetGame(), p_point, p_lhs);
-      },
-      [&p_start](const Vector<double> &p_point, Matrix<double> &p_jac) {
-        GetJacobian(p_start.GetGame(), p_point, p_jac);
-      },
-      x, p_omega,
-      [p_start, p_regret](const Vector<double> &p_point) {
-        return RegretTerminationFunction(p_start.GetGame(), p_point, p_regret);
-      },
-      [&callback](const Vector<double> &p_point) -> void { callback.AppendPoint(p_point); });
+  TraceToRegret<EquationSystem>(p_start.GetGame(), x, p_regret, p_omega, p_firstStep,
+                                p_maxAccel, p_stepObserver, callback);
+  return callback.GetProfiles();
+}
+
+List<LogitQREMixedStrategyProfile>
+LogitSymmetricStrategySolve(const LogitQREMixedStrategyProfile &p_start, double p_regret,
+                            double p_omega, double p_firstStep, double p_maxAccel,
+                            MixedStrategyObserverFunctionType p_observer,
+                            StepObserverFunctionType p_stepObserver)
+{
+  Vector<double> x(SymmetricProfileToPoint(p_start));
+  TracingCallbackFunction callback(p_start.GetGame(), p_observer, true);
+  TraceToRegret<SymmetricEquationSystem>(p_start.GetGame(), x, p_regret, p_omega, p_firstStep,
+                                         p_maxAccel, p_stepObserver, callback);
   return callback.GetProfiles();
 }
 
@@ -266,24 +581,27 @@ std::list<LogitQREMixedStrategyProfile>
 LogitStrategySolveLambda(const LogitQREMixedStrategyProfile &p_start,
                          const std::list<double> &p_targetLambda, double p_omega,
                          double p_firstStep, double p_maxAccel,
-                         MixedStrategyObserverFunctionType p_observer)
+                         MixedStrategyObserverFunctionType p_observer,
+                         StepObserverFunctionType p_stepObserver)
 {
-  PathTracer tracer;
+  PathTracer<double> tracer;
   tracer.SetMaxDecel(p_maxAccel);
   tracer.SetStepsize(p_firstStep);
+  tracer.SetStepObserver(p_stepObserver);
 
   Vector<double> x(ProfileToPoint(p_start));
   TracingCallbackFunction callback(p_start.GetGame(), p_observer);
+  EquationSystem<double> system(p_start.GetGame());
   std::list<LogitQREMixedStrategyProfile> ret;
   for (auto lam : p_targetLambda) {
     tracer.TracePath(
-        [&p_start](const Vector<double> &p_point, Vector<double> &p_lhs) {
-          GetValue(p_start.GetGame(), p_point, p_lhs);
+        [&system](const Vector<double> &p_point, Vector<double> &p_lhs) {
+          system.GetValue(p_point, p_lhs);
         },
-        [&p_start](const Vector<double> &p_point, Matrix<double> &p_jac) {
-          GetJacobian(p_start.GetGame(), p_point, p_jac);
+        [&system](const Vector<double> &p_point, Matrix<double> &p_jac) {
+          system.GetJacobian(p_point, p_jac);
         },
-        x, p_omega, LambdaPositiveTerminationFunction,
+        x, p_omega, LambdaPositiveTerminationFunction<double>,
         [&callback](const Vector<double> &p_point) -> void { callback.AppendPoint(p_point); },
         [lam](const Vector<double> &x, const Vector<double> &) -> double {
           return x.back() - lam;
@@ -299,7 +617,7 @@ LogitStrategyEstimate(const MixedStrategyProfile<double> &p_frequencies, double
                       MixedStrategyObserverFunctionType p_observer)
 {
   LogitQREMixedStrategyProfile start(p_frequencies.GetGame());
-  PathTracer tracer;
+  PathTracer<double> tracer;
   tracer.SetMaxDecel(p_maxAccel);
   tracer.SetStepsize(p_firstStep);
 
@@ -307,13 +625,14 @@ LogitStrategyEstimate(const MixedStrategyProfile<double> &p_frequencies, double
   Vector<double> freq_vector(static_cast<const Vector<double> &>(p_frequencies));
   EstimatorCallbackFunction callback(
       start.GetGame(), static_cast<const Vector<double> &>(p_frequencies), p_observer);
+  EquationSystem<double> system(start.GetGame());
   while (true) {
     tracer.TracePath(
-        [&start](const Vector<double> &p_point, Vector<double> &p_lhs) {
-          GetValue(start.GetGame(), p_point, p_lhs);
+        [&system](const Vector<double> &p_point, Vector<double> &p_lhs) {
+          system.GetValue(p_point, p_lhs);
         },
-        [&start](const Vector<double> &p_point, Matrix<double> &p_jac) {
-          GetJacobian(start.GetGame(), p_point, p_jac);
+        [&system](const Vector<double> &p_point, Matrix<double> &p_jac) {
+          system.GetJacobian(p_point, p_jac);
         },
         x, p_omega,
         [p_maxLambda](const Vector<double> &p_point) {
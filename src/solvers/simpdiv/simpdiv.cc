@@ -20,8 +20,11 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include <limits>
 #include <numeric>
 #include "gambit.h"
+#include "games/strattensor.h"
+#include "games/stratsym.h"
 #include "solvers/simpdiv/simpdiv.h"
 
 namespace Gambit::Nash {
@@ -66,72 +69,168 @@ public:
   explicit operator const Vector<T> &() const { return m_values; }
 };
 
-//-------------------------------------------------------------------------
-//          NashSimpdivStrategySolver: Private member functions
-//-------------------------------------------------------------------------
+namespace {
+
+/// Computes the value of each strategy at the points visited by the
+/// algorithm, for a game in table form.  Successive points differ in the
+/// strategies of only a few players, usually just one, so the values are
+/// kept from one point to the next, and updated for the change in each of
+/// these players' strategies in turn.  The update for a player visits only
+/// the slices of the table in which that player chooses a strategy whose
+/// probability has changed.  The values at the first point are obtained in
+/// the same way, from the profile in which all probabilities are zero.
+/// In floating point, the values are periodically computed afresh in this
+/// way, so rounding errors in the updates do not accumulate.
+template <class T> class TabulatedStrategyValues {
+private:
+  StrategicPayoffTensor<T> m_tensor;
+  Vector<T> m_probs, m_values;
+  std::vector<T> m_change;
+  int m_updates{0};
+
+public:
+  explicit TabulatedStrategyValues(const Game &p_game)
+    : m_tensor(p_game), m_probs(m_tensor.MixedProfileLength()),
+      m_values(m_tensor.MixedProfileLength())
+  {
+    m_probs = static_cast<T>(0);
+    m_values = static_cast<T>(0);
+  }
+
+  void operator()(const PVector<T> &p_point, PVector<T> &p_values);
+};
 
-inline GameStrategy GetStrategy(const Game &game, int pl, int st)
+template <class T>
+void TabulatedStrategyValues<T>::operator()(const PVector<T> &p_point, PVector<T> &p_values)
 {
-  return game->GetPlayer(pl)->GetStrategies()[st];
+  if (std::is_floating_point<T>::value && ++m_updates == 1000) {
+    m_probs = static_cast<T>(0);
+    m_values = static_cast<T>(0);
+    m_updates = 0;
+  }
+  const auto &point = static_cast<const Vector<T> &>(p_point);
+  for (int pl = 0; pl < m_tensor.NumPlayers(); pl++) {
+    const int first = m_tensor.FirstStrategy(pl) + 1;
+    const int count = m_tensor.NumStrategies(pl);
+    bool changed = false;
+    m_change.resize(count);
+    for (int st = 0; st < count; st++) {
+      m_change[st] = point[first + st] - m_probs[first + st];
+      changed = changed || m_change[st] != static_cast<T>(0);
+    }
+    if (changed) {
+      m_tensor.UpdateStrategyValues(m_probs, pl, m_change, m_values);
+      for (int st = 0; st < count; st++) {
+        m_probs[first + st] = point[first + st];
+      }
+    }
+  }
+  p_values = m_values;
+}
+
+/// Returns the largest regret of any player at the point, given the values
+/// of the strategies there
+template <class T> T MaxRegret(const PVector<T> &p_point, const PVector<T> &p_values)
+{
+  const Array<int> &nstrats = p_point.GetShape();
+  T maxRegret(0);
+  for (int i = 1; i <= static_cast<int>(nstrats.size()); i++) {
+    T payoff(0), maxval(p_values(i, 1));
+    for (int j = 1; j <= nstrats[i]; j++) {
+      payoff += p_point(i, j) * p_values(i, j);
+      maxval = std::max(maxval, p_values(i, j));
+    }
+    maxRegret = std::max(maxRegret, maxval - payoff);
+  }
+  return maxRegret;
 }
 
-class NashSimpdivStrategySolver::State {
+} // end anonymous namespace
+
+//-------------------------------------------------------------------------
+//          NashSimpdivStrategySolver: Private member functions
+//-------------------------------------------------------------------------
+
+template <class C, class V> class NashSimpdivStrategySolver::State {
 public:
   int m_leashLength;
   int t{0}, ibar{1};
-  Rational d, pay, maxz, bestz;
+  C d;
+  V denom, bestz;
+  PVector<V> probs, values;
 
-  explicit State(int p_leashLength) : m_leashLength(p_leashLength), bestz(1.0e30) {}
-  Rational getlabel(MixedStrategyProfile<Rational> &yy, Array<int> &, PVector<Rational> &);
+  State(int p_leashLength, const Array<int> &p_shape, const V &p_denom)
+    : m_leashLength(p_leashLength), denom(p_denom), bestz(1.0e30), probs(p_shape),
+      values(p_shape)
+  {
+  }
+  V getlabel(const PVector<C> &yy, Array<int> &, PVector<C> &, const ValueFunctionType<V> &);
 
   /* Check whether the distance p_dist is "too far" given the leash length, if set. */
-  bool CheckLeashOK(const Rational &p_dist) const
+  bool CheckLeashOK(const C &p_dist) const
   {
     if (m_leashLength == 0) {
       return true;
     }
     return p_dist < m_leashLength * d;
   }
+
+  /// Returns the probabilities at the point, which are its coordinates
+  /// divided by the denominator of the grid when these are integers
+  const PVector<V> &GetProbabilities(const PVector<C> &p_point)
+  {
+    if constexpr (std::is_same<C, V>::value) {
+      return p_point;
+    }
+    else {
+      const auto &point = static_cast<const Vector<C> &>(p_point);
+      for (size_t i = 1; i <= probs.size(); i++) {
+        probs[i] = static_cast<V>(point[i]) / denom;
+      }
+      return probs;
+    }
+  }
 };
 
 /// @brief Implementation of the piecewise path-following algorithm
+/// @details The coordinates of the points are of type C, and are those of
+///          the probabilities multiplied by p_denom.
 /// @returns The maximum regret of any player at the terminal profile
-Rational NashSimpdivStrategySolver::Simplex(MixedStrategyProfile<Rational> &y,
-                                            const Rational &d) const
+template <class C, class V>
+V NashSimpdivStrategySolver::Simplex(PVector<C> &y, const C &d, const V &p_denom,
+                                     const ValueFunctionType<V> &p_values) const
 {
-  Game game = y.GetGame();
-  State state(m_leashLength);
+  const Array<int> &nstrats = y.GetShape();
+  State<C, V> state(m_leashLength, nstrats, p_denom);
   state.d = d;
-  Array<int> nstrats(game->NumStrategies());
   Array<int> ylabel(2);
-  RectArray<int> labels(y.MixedProfileLength(), 2), pi(y.MixedProfileLength(), 2);
+  RectArray<int> labels(y.size(), 2), pi(y.size(), 2);
   PVector<int> U(nstrats), TT(nstrats);
-  PVector<Rational> ab(nstrats), besty(nstrats), v(nstrats);
+  PVector<C> ab(nstrats), besty(nstrats), v(nstrats);
   for (size_t i = 1; i <= v.size(); i++) {
     v[i] = y[i];
   }
-  besty = static_cast<const Vector<Rational> &>(y);
+  besty = static_cast<const Vector<C> &>(y);
   int i = 0;
   int j, k, h, jj, hh, ii, kk, tot;
-  Rational maxz;
+  V maxz;
 
   // Label step0 not currently used, hence commented
   // step0:
   TT = 0;
   U = 0;
-  ab = Rational(0);
-  for (j = 1; j <= game->NumPlayers(); j++) {
-    GamePlayer player = game->GetPlayer(j);
+  ab = C(0);
+  for (j = 1; j <= static_cast<int>(nstrats.size()); j++) {
     for (h = 1; h <= nstrats[j]; h++) {
-      if (v(j, h) == Rational(0)) {
+      if (v(j, h) == C(0)) {
         U(j, h) = 1;
       }
-      y[player->GetStrategies()[h]] = v(j, h);
+      y(j, h) = v(j, h);
     }
   }
 
 step1:
-  maxz = state.getlabel(y, ylabel, besty);
+  maxz = state.getlabel(y, ylabel, besty, p_values);
   j = ylabel[1];
   h = ylabel[2];
   labels(state.ibar, 1) = j;
@@ -216,8 +315,8 @@ step3:
   getY(state, y, v, U, TT, ab, pi, ii);
 
   /* case3a */
-  if (i == 1 && (y[GetStrategy(game, j, k)] <= Rational(0) ||
-                 !state.CheckLeashOK(v(j, k) - y[GetStrategy(game, j, k)]))) {
+  if (i == 1 && (y(j, k) <= C(0) ||
+                 !state.CheckLeashOK(v(j, k) - y(j, k)))) {
     for (hh = 1, tot = 0; hh <= nstrats[j]; hh++) {
       if (TT(j, hh) == 1 || U(j, hh) == 1) {
         tot++;
@@ -236,19 +335,19 @@ step3:
   }
   /* case3b */
   else if (i >= 2 && i <= state.t &&
-           (y[GetStrategy(game, j, k)] <= Rational(0) ||
-            !state.CheckLeashOK(v(j, k) - y[GetStrategy(game, j, k)]))) {
+           (y(j, k) <= C(0) ||
+            !state.CheckLeashOK(v(j, k) - y(j, k)))) {
     goto step4;
   }
   /* case3c */
-  else if (i == state.t + 1 && ab(j, kk) == Rational(0)) {
-    if (y[GetStrategy(game, j, h)] <= Rational(0) ||
-        !state.CheckLeashOK(v(j, h) - y[GetStrategy(game, j, h)])) {
+  else if (i == state.t + 1 && ab(j, kk) == C(0)) {
+    if (y(j, h) <= C(0) ||
+        !state.CheckLeashOK(v(j, h) - y(j, h))) {
       goto step4;
     }
     else {
       k = 0;
-      while (ab(j, kk) == Rational(0) && k == 0) {
+      while (ab(j, kk) == C(0) && k == 0) {
         if (kk == h) {
           k = 1;
         }
@@ -280,8 +379,8 @@ step3:
       j = pi(state.t, 1);
       h = pi(state.t, 2);
       hh = get_b(j, h, nstrats[j], U);
-      y[GetStrategy(game, j, h)] -= state.d;
-      y[GetStrategy(game, j, hh)] += state.d;
+      y(j, h) -= state.d;
+      y(j, hh) += state.d;
     }
     update(state, pi, labels, ab, U, j, i);
   }
@@ -292,8 +391,8 @@ step4:
   j = pi(i - 1, 1);
   h = pi(i - 1, 2);
   TT(j, h) = 0;
-  if (y[GetStrategy(game, j, h)] <= Rational(0) ||
-      !state.CheckLeashOK(v(j, h) - y[GetStrategy(game, j, h)])) {
+  if (y(j, h) <= C(0) ||
+      !state.CheckLeashOK(v(j, h) - y(j, h))) {
     U(j, h) = 1;
   }
   labels.RotateUp(i, state.t + 1);
@@ -315,8 +414,8 @@ step5:
   jj = pi(1, 1);
   hh = pi(1, 2);
   kk = get_b(jj, hh, nstrats[jj], U);
-  y[GetStrategy(game, jj, hh)] -= state.d;
-  y[GetStrategy(game, jj, kk)] += state.d;
+  y(jj, hh) -= state.d;
+  y(jj, kk) += state.d;
 
   k = get_c(j, h, nstrats[j], U);
   kk = 1;
@@ -324,7 +423,7 @@ step5:
     if (k == h) {
       kk = 0;
     }
-    ab(j, k) -= Rational(1);
+    ab(j, k) -= C(1);
     k++;
     if (k > nstrats[j]) {
       k = 1;
@@ -334,16 +433,14 @@ step5:
 
 end:
   maxz = state.bestz;
-  for (i = 1; i <= game->NumPlayers(); i++) {
-    for (j = 1; j <= nstrats[i]; j++) {
-      y[GetStrategy(game, i, j)] = besty(i, j);
-    }
-  }
+  y = besty;
   return maxz;
 }
 
-void NashSimpdivStrategySolver::update(State &state, RectArray<int> &pi, RectArray<int> &labels,
-                                       PVector<Rational> &ab, const PVector<int> &U, int j, int i)
+template <class C, class V>
+void NashSimpdivStrategySolver::update(State<C, V> &state, RectArray<int> &pi,
+                                       RectArray<int> &labels, PVector<C> &ab,
+                                       const PVector<int> &U, int j, int i)
 {
   int jj, hh, k, f = 1;
 
@@ -362,7 +459,7 @@ void NashSimpdivStrategySolver::update(State &state, RectArray<int> &pi, RectArr
         if (k == hh) {
           f = 0;
         }
-        ab(j, k) += Rational(1);
+        ab(j, k) += C(1);
         k++;
         if (k > ab.GetShape()[jj]) {
           k = 1;
@@ -382,7 +479,7 @@ void NashSimpdivStrategySolver::update(State &state, RectArray<int> &pi, RectArr
         if (k == hh) {
           f = 0;
         }
-        ab(j, k) -= Rational(1);
+        ab(j, k) -= C(1);
         k++;
         if (k > ab.GetShape()[jj]) {
           k = 1;
@@ -393,19 +490,19 @@ void NashSimpdivStrategySolver::update(State &state, RectArray<int> &pi, RectArr
   }
 }
 
-void NashSimpdivStrategySolver::getY(const State &state, MixedStrategyProfile<Rational> &x,
-                                     PVector<Rational> &v, const PVector<int> &U,
-                                     const PVector<int> &TT, const PVector<Rational> &ab,
-                                     const RectArray<int> &pi, int k)
+template <class C, class V>
+void NashSimpdivStrategySolver::getY(const State<C, V> &state, PVector<C> &x, PVector<C> &v,
+                                     const PVector<int> &U, const PVector<int> &TT,
+                                     const PVector<C> &ab, const RectArray<int> &pi, int k)
 {
-  x = static_cast<const Vector<Rational> &>(v);
-  for (int j = 1; j <= x.GetGame()->NumPlayers(); j++) {
-    GamePlayer player = x.GetGame()->GetPlayer(j);
-    for (size_t h = 1; h <= player->GetStrategies().size(); h++) {
+  x = v;
+  const Array<int> &nstrats = x.GetShape();
+  for (int j = 1; j <= static_cast<int>(nstrats.size()); j++) {
+    for (int h = 1; h <= nstrats[j]; h++) {
       if (TT(j, h) == 1 || U(j, h) == 1) {
-        x[player->GetStrategies()[h]] += state.d * ab(j, h);
-        int hh = (h > 1) ? h - 1 : player->GetStrategies().size();
-        x[player->GetStrategies()[hh]] -= state.d * ab(j, h);
+        x(j, h) += state.d * ab(j, h);
+        int hh = (h > 1) ? h - 1 : nstrats[j];
+        x(j, hh) -= state.d * ab(j, h);
       }
     }
   }
@@ -414,15 +511,15 @@ void NashSimpdivStrategySolver::getY(const State &state, MixedStrategyProfile<Ra
   }
 }
 
-void NashSimpdivStrategySolver::getnexty(const State &state, MixedStrategyProfile<Rational> &x,
+template <class C, class V>
+void NashSimpdivStrategySolver::getnexty(const State<C, V> &state, PVector<C> &x,
                                          const RectArray<int> &pi, const PVector<int> &U, int i)
 {
   int j = pi(i, 1);
-  GamePlayer player = x.GetGame()->GetPlayer(j);
   int h = pi(i, 2);
-  x[player->GetStrategies()[h]] += state.d;
-  int hh = get_b(j, h, player->GetStrategies().size(), U);
-  x[player->GetStrategies()[hh]] -= state.d;
+  x(j, h) += state.d;
+  int hh = get_b(j, h, x.GetShape()[j], U);
+  x(j, hh) -= state.d;
 }
 
 int NashSimpdivStrategySolver::get_b(int j, int h, int nstrats, const PVector<int> &U)
@@ -443,21 +540,25 @@ int NashSimpdivStrategySolver::get_c(int j, int h, int nstrats, const PVector<in
   return (hh > nstrats) ? 1 : hh;
 }
 
-Rational NashSimpdivStrategySolver::State::getlabel(MixedStrategyProfile<Rational> &yy,
-                                                    Array<int> &ylabel, PVector<Rational> &besty)
+template <class C, class V>
+V NashSimpdivStrategySolver::State<C, V>::getlabel(const PVector<C> &yy, Array<int> &ylabel,
+                                                   PVector<C> &besty,
+                                                   const ValueFunctionType<V> &p_values)
 {
-  Rational maxz(-1000000);
+  V maxz(-1000000);
   ylabel[1] = 1;
   ylabel[2] = 1;
 
-  for (int i = 1; i <= yy.GetGame()->NumPlayers(); i++) {
-    GamePlayer player = yy.GetGame()->GetPlayer(i);
-    Rational payoff(0);
-    Rational maxval(-1000000);
+  const PVector<V> &point = GetProbabilities(yy);
+  p_values(point, values);
+  const Array<int> &nstrats = yy.GetShape();
+  for (int i = 1; i <= static_cast<int>(nstrats.size()); i++) {
+    V payoff(0);
+    V maxval(-1000000);
     int jj = 0;
-    for (size_t j = 1; j <= player->GetStrategies().size(); j++) {
-      pay = yy.GetPayoff(player->GetStrategies()[j]);
-      payoff += yy[player->GetStrategies()[j]] * pay;
+    for (int j = 1; j <= nstrats[i]; j++) {
+      const V &pay = values(i, j);
+      payoff += point(i, j) * pay;
       if (pay > maxval) {
         maxval = pay;
         jj = j;
@@ -471,12 +572,7 @@ Rational NashSimpdivStrategySolver::State::getlabel(MixedStrategyProfile<Rationa
   }
   if (maxz < bestz) {
     bestz = maxz;
-    for (int i = 1; i <= yy.GetGame()->NumPlayers(); i++) {
-      GamePlayer player = yy.GetGame()->GetPlayer(i);
-      for (size_t j = 1; j <= player->GetStrategies().size(); j++) {
-        besty(i, j) = yy[player->GetStrategies()[j]];
-      }
-    }
+    besty = yy;
   }
   return maxz;
 }
@@ -494,36 +590,187 @@ inline Integer find_lcd(const Vector<Rational> &vec)
   return lcd;
 }
 
-List<MixedStrategyProfile<Rational>>
-NashSimpdivStrategySolver::Solve(const MixedStrategyProfile<Rational> &p_start) const
+/// @brief Subdivides on grids with integer coordinates and floating-point labels
+/// @details The point is represented by its coordinates on the grid, which
+///          are integers summing to the denominator of the grid for each
+///          player, and the strategy values are computed in floating point.
+///          Each time a point is found whose regret in floating point is
+///          within the tolerance, the regret is checked in exact arithmetic.
+///          This continues until the denominator of the grid would exceed
+///          the range of int, the range within which integers are converted
+///          exactly to Rational.
+/// @returns True if the point meets the tolerance in exact arithmetic.  In
+///          either case, y and d are the point and grid size reached.
+bool NashSimpdivStrategySolver::SubdivideOnGrid(PVector<Rational> &y, Rational &d,
+                                                const Rational &scale,
+                                                const ValueFunctionType<Rational> &p_values,
+                                                const ValueFunctionType<double> &p_floatValues,
+                                                const ProfileFunctionType &p_toProfile) const
 {
-  if (!p_start.GetGame()->IsPerfectRecall()) {
-    throw UndefinedException(
-        "Computing equilibria of games with imperfect recall is not supported.");
+  const long maxDenom = std::numeric_limits<int>::max();
+  if (d.numerator() != Integer(1) || d.denominator() > Integer(maxDenom)) {
+    return false;
+  }
+  long denom = d.denominator().as_long();
+  PVector<long> point(y.GetShape());
+  for (size_t i = 1; i <= y.size(); i++) {
+    point[i] = (y[i] * Rational(denom)).numerator().as_long();
+  }
+  const Rational tolerance = m_maxregret * scale;
+  PVector<Rational> values(y.GetShape());
+
+  while (denom <= maxDenom / m_gridResize) {
+    denom *= m_gridResize;
+    for (size_t i = 1; i <= point.size(); i++) {
+      point[i] *= m_gridResize;
+    }
+    const double regret = Simplex(point, 1L, static_cast<double>(denom), p_floatValues);
+    for (size_t i = 1; i <= y.size(); i++) {
+      y[i] = Rational(point[i], denom);
+    }
+    d = Rational(1L, denom);
+
+    if (m_verbose) {
+      this->m_onEquilibrium->Render(p_toProfile(y), std::to_string(d));
+    }
+    if (regret <= static_cast<double>(tolerance)) {
+      p_values(y, values);
+      if (MaxRegret(y, values) <= tolerance) {
+        return true;
+      }
+    }
   }
-  Rational d(Integer(1), find_lcd(static_cast<const Vector<Rational> &>(p_start)));
-  Rational scale = p_start.GetGame()->GetMaxPayoff() - p_start.GetGame()->GetMinPayoff();
+  return false;
+}
 
-  MixedStrategyProfile<Rational> y(p_start);
+MixedStrategyProfile<Rational>
+NashSimpdivStrategySolver::Subdivide(PVector<Rational> &y, Rational d, const Rational &scale,
+                                     const ValueFunctionType<Rational> &p_values,
+                                     const ValueFunctionType<double> &p_floatValues,
+                                     const ProfileFunctionType &p_toProfile) const
+{
   if (m_verbose) {
-    this->m_onEquilibrium->Render(y, "start");
+    this->m_onEquilibrium->Render(p_toProfile(y), "start");
+  }
+  if (m_floatingPoint && SubdivideOnGrid(y, d, scale, p_values, p_floatValues, p_toProfile)) {
+    return p_toProfile(y);
   }
 
   while (true) {
     d /= Rational(m_gridResize);
-    Rational regret = Simplex(y, d);
+    Rational regret = Simplex(y, d, Rational(1), p_values);
 
     if (m_verbose) {
-      this->m_onEquilibrium->Render(y, std::to_string(d));
+      this->m_onEquilibrium->Render(p_toProfile(y), std::to_string(d));
     }
     if (regret <= m_maxregret * scale) {
       break;
     }
   }
+  return p_toProfile(y);
+}
+
+List<MixedStrategyProfile<Rational>>
+NashSimpdivStrategySolver::Solve(const MixedStrategyProfile<Rational> &p_start) const
+{
+  if (!p_start.GetGame()->IsPerfectRecall()) {
+    throw UndefinedException(
+        "Computing equilibria of games with imperfect recall is not supported.");
+  }
+  const Game game = p_start.GetGame();
+  Rational d(Integer(1), find_lcd(static_cast<const Vector<Rational> &>(p_start)));
+  Rational scale = game->GetMaxPayoff() - game->GetMinPayoff();
+
+  PVector<Rational> y(game->NumStrategies());
+  y = static_cast<const Vector<Rational> &>(p_start);
+  MixedStrategyProfile<Rational> profile(p_start);
+  auto toProfile = [&profile](const PVector<Rational> &p_point) {
+    profile = static_cast<const Vector<Rational> &>(p_point);
+    return profile;
+  };
+  const Array<GameStrategy> strategies = game->GetStrategies();
+  ValueFunctionType<Rational> values = [&profile,
+                                        &strategies](const PVector<Rational> &p_point,
+                                                     PVector<Rational> &p_values) {
+    profile = static_cast<const Vector<Rational> &>(p_point);
+    for (size_t i = 1; i <= strategies.size(); i++) {
+      p_values[i] = profile.GetPayoff(strategies[i]);
+    }
+  };
+  ValueFunctionType<double> floatValues;
+  if (StrategicPayoffTensor<Rational>::IsTabulated(game)) {
+    auto tabulated = std::make_shared<TabulatedStrategyValues<Rational>>(game);
+    values = [tabulated](const PVector<Rational> &p_point, PVector<Rational> &p_values) {
+      (*tabulated)(p_point, p_values);
+    };
+    if (m_floatingPoint) {
+      auto floatTabulated = std::make_shared<TabulatedStrategyValues<double>>(game);
+      floatValues = [floatTabulated](const PVector<double> &p_point, PVector<double> &p_values) {
+        (*floatTabulated)(p_point, p_values);
+      };
+    }
+  }
+  else if (m_floatingPoint) {
+    auto floatProfile =
+        std::make_shared<MixedStrategyProfile<double>>(game->NewMixedStrategyProfile(0.0));
+    floatValues = [floatProfile, &strategies](const PVector<double> &p_point,
+                                              PVector<double> &p_values) {
+      *floatProfile = static_cast<const Vector<double> &>(p_point);
+      for (size_t i = 1; i <= strategies.size(); i++) {
+        p_values[i] = floatProfile->GetPayoff(strategies[i]);
+      }
+    };
+  }
+
+  List<MixedStrategyProfile<Rational>> sol;
+  sol.push_back(Subdivide(y, d, scale, values, floatValues, toProfile));
+  this->m_onEquilibrium->Render(sol.back());
+  return sol;
+}
+
+List<MixedStrategyProfile<Rational>>
+NashSimpdivStrategySolver::SolveSymmetric(const MixedStrategyProfile<Rational> &p_start) const
+{
+  const Game game = p_start.GetGame();
+  const SymmetricPayoffTable<Rational> table(game);
+  const GamePlayer player = game->GetPlayer(1);
+  Vector<Rational> start(player->NumStrategies());
+  for (size_t st = 1; st <= player->NumStrategies(); st++) {
+    start[st] = p_start[player->GetStrategy(st)];
+  }
+  Rational d(Integer(1), find_lcd(start));
+  Rational scale = game->GetMaxPayoff() - game->GetMinPayoff();
+
+  // The subdivision is carried out on the strategy simplex of one player
+  Array<int> shape(1);
+  shape[1] = player->NumStrategies();
+  PVector<Rational> y(shape);
+  y = start;
+  Vector<Rational> probs(start), strategyValues(start);
+  auto toProfile = [&game, &probs](const PVector<Rational> &p_point) {
+    probs = static_cast<const Vector<Rational> &>(p_point);
+    return SymmetricProfile(game, probs);
+  };
+  auto values = [&table, &probs, &strategyValues](const PVector<Rational> &p_point,
+                                                  PVector<Rational> &p_values) {
+    probs = static_cast<const Vector<Rational> &>(p_point);
+    table.GetStrategyValues(probs, strategyValues);
+    p_values = strategyValues;
+  };
+  ValueFunctionType<double> floatValues;
+  if (m_floatingPoint) {
+    auto floatTable = std::make_shared<const SymmetricPayoffTable<double>>(game);
+    floatValues = [floatTable](const PVector<double> &p_point, PVector<double> &p_values) {
+      const auto &probs = static_cast<const Vector<double> &>(p_point);
+      Vector<double> strategyValues(probs.size());
+      floatTable->GetStrategyValues(probs, strategyValues);
+      p_values = strategyValues;
+    };
+  }
 
-  this->m_onEquilibrium->Render(y);
   List<MixedStrategyProfile<Rational>> sol;
-  sol.push_back(y);
+  sol.push_back(Subdivide(y, d, scale, values, floatValues, toProfile));
+  this->m_onEquilibrium->Render(sol.back());
   return sol;
 }
 
@@ -38,10 +38,11 @@ public:
   explicit NashSimpdivStrategySolver(
       int p_gridResize = 2, int p_leashLength = 0,
       const Rational &p_maxregret = Rational(1, 1000000), bool p_verbose = false,
-      std::shared_ptr<StrategyProfileRenderer<Rational>> p_onEquilibrium = nullptr)
+      std::shared_ptr<StrategyProfileRenderer<Rational>> p_onEquilibrium = nullptr,
+      bool p_floatingPoint = false)
     : StrategySolver<Rational>(p_onEquilibrium), m_gridResize(p_gridResize),
       m_leashLength((p_leashLength > 0) ? p_leashLength : 32000), m_maxregret(p_maxregret),
-      m_verbose(p_verbose)
+      m_verbose(p_verbose), m_floatingPoint(p_floatingPoint)
   {
   }
   ~NashSimpdivStrategySolver() override = default;
@@ -49,20 +50,49 @@ public:
   List<MixedStrategyProfile<Rational>> Solve(const MixedStrategyProfile<Rational> &p_start) const;
   List<MixedStrategyProfile<Rational>> Solve(const Game &p_game) const override;
 
+  /// Compute a symmetric equilibrium of a symmetric game, in which all players
+  /// adopt the same mixed strategy.  The subdivision is carried out on the
+  /// simplex of mixed strategies of a single player, starting from the
+  /// strategy of the first player in p_start.
+  /// @exception UndefinedException  If the game is not symmetric
+  List<MixedStrategyProfile<Rational>>
+  SolveSymmetric(const MixedStrategyProfile<Rational> &p_start) const;
+
 private:
   int m_gridResize, m_leashLength;
   Rational m_maxregret;
-  bool m_verbose;
+  bool m_verbose, m_floatingPoint;
+
+  /// The state of the path-following algorithm, with grid coordinates of
+  /// type C and strategy values of type V
+  template <class C, class V> class State;
 
-  class State;
+  /// Computes the payoff to each strategy of each player at a point
+  template <class V>
+  using ValueFunctionType = std::function<void(const PVector<V> &, PVector<V> &)>;
+  /// Converts a point to the corresponding profile on the game
+  using ProfileFunctionType =
+      std::function<MixedStrategyProfile<Rational>(const PVector<Rational> &)>;
 
-  Rational Simplex(MixedStrategyProfile<Rational> &, const Rational &d) const;
-  static void update(State &, RectArray<int> &, RectArray<int> &, PVector<Rational> &,
+  MixedStrategyProfile<Rational> Subdivide(PVector<Rational> &y, Rational d, const Rational &scale,
+                                           const ValueFunctionType<Rational> &p_values,
+                                           const ValueFunctionType<double> &p_floatValues,
+                                           const ProfileFunctionType &p_toProfile) const;
+  bool SubdivideOnGrid(PVector<Rational> &y, Rational &d, const Rational &scale,
+                       const ValueFunctionType<Rational> &p_values,
+                       const ValueFunctionType<double> &p_floatValues,
+                       const ProfileFunctionType &p_toProfile) const;
+  template <class C, class V>
+  V Simplex(PVector<C> &, const C &d, const V &p_denom,
+            const ValueFunctionType<V> &p_values) const;
+  template <class C, class V>
+  static void update(State<C, V> &, RectArray<int> &, RectArray<int> &, PVector<C> &,
                      const PVector<int> &, int j, int i);
-  static void getY(const State &, MixedStrategyProfile<Rational> &x, PVector<Rational> &,
-                   const PVector<int> &, const PVector<int> &, const PVector<Rational> &,
-                   const RectArray<int> &, int k);
-  static void getnexty(const State &, MixedStrategyProfile<Rational> &x, const RectArray<int> &,
+  template <class C, class V>
+  static void getY(const State<C, V> &, PVector<C> &x, PVector<C> &, const PVector<int> &,
+                   const PVector<int> &, const PVector<C> &, const RectArray<int> &, int k);
+  template <class C, class V>
+  static void getnexty(const State<C, V> &, PVector<C> &x, const RectArray<int> &,
                        const PVector<int> &, int i);
   static int get_c(int j, int h, int nstrats, const PVector<int> &);
   static int get_b(int j, int h, int nstrats, const PVector<int> &);
@@ -0,0 +1,329 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/solvers/tracing/nfgtracing.cc
+// Linear tracing procedure for strategic games
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <cmath>
+
+#include "gambit.h"
+#include "core/sqmatrix.h"
+#include "games/strattensor.h"
+#include "tracing.h"
+#include "solvers/homotopy/path.h"
+
+namespace Gambit {
+
+namespace {
+
+// The weight of the logarithmic penalty at the start of the path, relative to
+// the range of payoffs in the game.
+const double c_penalty = 0.1;
+
+//
+// This class evaluates the system of equations defining the smoothed
+// tracing path.  At parameter t, each player i best responds to the
+// profile in which the other players play their current strategies with
+// probability t, and the prior with probability (1-t), subject to a
+// penalty (1-t) * alpha * sum_s log(sigma_s).  The first-order conditions
+// are, for each strategy s of player i,
+//   sigma_s * (lambda_i - t * v_s(sigma) - (1-t) * v_s(prior)) - (1-t) * alpha = 0
+// together with the requirement that the probabilities of each player sum
+// to one.  The point consists of the probabilities, the multipliers
+// lambda_i, and t.  Payoffs are scaled by the range of payoffs in the game.
+//
+class EquationSystem {
+public:
+  explicit EquationSystem(const MixedStrategyProfile<double> &p_prior);
+  ~EquationSystem() = default;
+
+  // Compute the point at which the path starts
+  Vector<double> GetStartPoint() const;
+
+  // Compute the value of the system of equations at the specified point.
+  void GetValue(const Vector<double> &p_point, Vector<double> &p_lhs);
+
+  // Compute the Jacobian matrix at the specified point.
+  void GetJacobian(const Vector<double> &p_point, Matrix<double> &p_matrix);
+
+  // Convert the point to the corresponding mixed strategy profile
+  MixedStrategyProfile<double> GetProfile(const Vector<double> &p_point) const;
+
+private:
+  void ComputeValues(const Vector<double> &p_point, bool p_derivs);
+
+  Game m_game;
+  std::unique_ptr<StrategicPayoffTensor<double>> m_tensor;
+  MixedStrategyProfile<double> m_profile;
+  Array<GameStrategy> m_strategies;
+  // The first strategy index, and number of strategies, of each player
+  Array<int> m_first, m_size;
+  double m_scale;
+  // The (scaled) values of strategies against the prior
+  Vector<double> m_priorValues;
+  Vector<double> m_probs, m_values;
+  std::vector<double> m_derivs;
+};
+
+EquationSystem::EquationSystem(const MixedStrategyProfile<double> &p_prior)
+  : m_game(p_prior.GetGame()), m_profile(m_game->NewMixedStrategyProfile(0.0)),
+    m_strategies(m_game->GetStrategies()), m_first(m_game->NumPlayers()),
+    m_size(m_game->NumPlayers()), m_scale(1.0), m_priorValues(m_game->MixedProfileLength()),
+    m_probs(m_game->MixedProfileLength()), m_values(m_game->MixedProfileLength()),
+    m_derivs(m_probs.size() * m_probs.size())
+{
+  if (StrategicPayoffTensor<double>::IsTabulated(m_game)) {
+    m_tensor = std::make_unique<StrategicPayoffTensor<double>>(m_game);
+  }
+  for (int pl = 1, first = 1; pl <= m_game->NumPlayers(); pl++) {
+    m_first[pl] = first;
+    m_size[pl] = m_game->GetPlayer(pl)->NumStrategies();
+    first += m_size[pl];
+  }
+  const double range = static_cast<double>(m_game->GetMaxPayoff() - m_game->GetMinPayoff());
+  if (range > 0.0) {
+    m_scale = 1.0 / range;
+  }
+  for (int i = 1; i <= m_priorValues.size(); i++) {
+    m_priorValues[i] = m_scale * p_prior.GetPayoff(m_strategies[i]);
+  }
+}
+
+Vector<double> EquationSystem::GetStartPoint() const
+{
+  // At t = 0, sigma_s = alpha / (lambda_i - v_s(prior)), where lambda_i is the
+  // unique value exceeding all v_s(prior) for which these sum to one.  The sum
+  // is decreasing in lambda_i, and is at least one at the lower end, and at
+  // most one at the upper end, of the interval bracketing lambda_i below.
+  const int n = m_probs.size();
+  Vector<double> point(n + m_first.size() + 1);
+  for (int pl = 1; pl <= m_first.size(); pl++) {
+    const int first = m_first[pl];
+    double best = m_priorValues[first];
+    for (int st = first + 1; st < first + m_size[pl]; st++) {
+      best = std::max(best, m_priorValues[st]);
+    }
+    double lo = best + c_penalty, hi = best + m_size[pl] * c_penalty;
+    for (int iter = 0; iter < 100 && hi - lo > 1.0e-15 * hi; iter++) {
+      const double mid = 0.5 * (lo + hi);
+      double total = 0.0;
+      for (int st = first; st < first + m_size[pl]; st++) {
+        total += c_penalty / (mid - m_priorValues[st]);
+      }
+      ((total > 1.0) ? lo : hi) = mid;
+    }
+    const double lambda = 0.5 * (lo + hi);
+    double total = 0.0;
+    for (int st = first; st < first + m_size[pl]; st++) {
+      point[st] = c_penalty / (lambda - m_priorValues[st]);
+      total += point[st];
+    }
+    for (int st = first; st < first + m_size[pl]; st++) {
+      point[st] /= total;
+    }
+    point[n + pl] = lambda;
+  }
+  point.back() = 0.0;
+  return point;
+}
+
+void EquationSystem::ComputeValues(const Vector<double> &p_point, bool p_derivs)
+{
+  for (int i = 1; i <= m_probs.size(); i++) {
+    m_probs[i] = p_point[i];
+  }
+  if (m_tensor) {
+    if (p_derivs) {
+      m_tensor->GetPayoffDerivs(m_probs, m_values, m_derivs);
+    }
+    else {
+      m_tensor->GetStrategyValues(m_probs, m_values);
+    }
+  }
+  else {
+    for (int i = 1; i <= m_probs.size(); i++) {
+      m_profile[i] = m_probs[i];
+    }
+    const size_t n = m_values.size();
+    for (size_t i = 1; i <= n; i++) {
+      const GameStrategy &strategy = m_strategies[i];
+      GamePlayer player = strategy->GetPlayer();
+      m_values[i] = m_profile.GetPayoff(strategy);
+      if (!p_derivs) {
+        continue;
+      }
+      for (size_t j = 1; j <= n; j++) {
+        m_derivs[(i - 1) * n + j - 1] =
+            (m_strategies[j]->GetPlayer() == player)
+                ? 0.0
+                : m_profile.GetPayoffDeriv(player->GetNumber(), strategy, m_strategies[j]);
+      }
+    }
+  }
+  m_values *= m_scale;
+}
+
+void EquationSystem::GetValue(const Vector<double> &p_point, Vector<double> &p_lhs)
+{
+  ComputeValues(p_point, false);
+  const int n = m_probs.size();
+  const double t = p_point.back();
+  for (int pl = 1; pl <= m_first.size(); pl++) {
+    const int first = m_first[pl];
+    const double lambda = p_point[n + pl];
+    p_lhs[n + pl] = -1.0;
+    for (int st = first; st < first + m_size[pl]; st++) {
+      p_lhs[st] = (m_probs[st] * (lambda - t * m_values[st] - (1.0 - t) * m_priorValues[st]) -
+                   (1.0 - t) * c_penalty);
+      p_lhs[n + pl] += m_probs[st];
+    }
+  }
+}
+
+void EquationSystem::GetJacobian(const Vector<double> &p_point, Matrix<double> &p_matrix)
+{
+  ComputeValues(p_point, true);
+  const int n = m_probs.size();
+  const double t = p_point.back();
+
+  p_matrix = 0.0;
+  for (int pl = 1; pl <= m_first.size(); pl++) {
+    const int first = m_first[pl];
+    const double lambda = p_point[n + pl];
+    for (int st = first; st < first + m_size[pl]; st++) {
+      const double *row = &m_derivs[(st - 1) * n];
+      // Derivatives with respect to the player's own probability and multiplier
+      p_matrix(st, st) = lambda - t * m_values[st] - (1.0 - t) * m_priorValues[st];
+      p_matrix(n + pl, st) = m_probs[st];
+      // Derivatives with respect to other players' probabilities
+      for (int st2 = 1; st2 <= n; st2++) {
+        if (row[st2 - 1] != 0.0) {
+          p_matrix(st2, st) = -m_probs[st] * t * m_scale * row[st2 - 1];
+        }
+      }
+      // The last row is the derivative wrt t
+      p_matrix(p_matrix.NumRows(), st) =
+          -m_probs[st] * (m_values[st] - m_priorValues[st]) + c_penalty;
+      // The sum-to-one equation
+      p_matrix(st, n + pl) = 1.0;
+    }
+  }
+}
+
+MixedStrategyProfile<double> EquationSystem::GetProfile(const Vector<double> &p_point) const
+{
+  // Near the end of the path, the probabilities of strategies which are not
+  // best responses may be computed as being slightly negative.
+  MixedStrategyProfile<double> profile(m_game->NewMixedStrategyProfile(0.0));
+  for (int i = 1; i <= m_probs.size(); i++) {
+    profile[i] = std::max(p_point[i], 0.0);
+  }
+  return profile.Normalize();
+}
+
+// The tracer stops when it can no longer reduce its step in approaching t = 1.
+// Refine the last point by Newton's method on the system with t fixed at one,
+// where it is a Nash equilibrium.  Returns false if the system is singular
+// there (as it is when the equilibrium reached is not isolated) or Newton's
+// method fails to improve the point, in which case p_point is unchanged.
+bool RefineEndpoint(EquationSystem &p_system, Vector<double> &p_point)
+{
+  const int size = p_point.size() - 1;
+  Vector<double> point(p_point), lhs(size);
+  Matrix<double> jacobian(size + 1, size);
+  SquareMatrix<double> square(size);
+  point.back() = 1.0;
+  p_system.GetValue(point, lhs);
+  const double initial = lhs.NormSquared();
+  double residual = initial;
+  for (int iter = 0; iter < 10 && residual > 1.0e-28; iter++) {
+    p_system.GetJacobian(point, jacobian);
+    for (int i = 1; i <= size; i++) {
+      for (int j = 1; j <= size; j++) {
+        square(i, j) = jacobian(i, j);
+      }
+    }
+    try {
+      // The Jacobian is stored with one column per equation
+      Vector<double> step(lhs * square.Inverse());
+      for (int i = 1; i <= size; i++) {
+        point[i] -= step[i];
+      }
+    }
+    catch (SingularMatrixException &) {
+      return false;
+    }
+    p_system.GetValue(point, lhs);
+    residual = lhs.NormSquared();
+  }
+  if (residual >= initial) {
+    return false;
+  }
+  p_point = point;
+  return true;
+}
+
+} // namespace
+
+List<TracingMixedStrategyProfile> TracingStrategySolve(const MixedStrategyProfile<double> &p_prior,
+                                                       double p_firstStep, double p_maxAccel,
+                                                       TracingObserverFunctionType p_observer)
+{
+  PathTracer<double> tracer;
+  tracer.SetMaxDecel(p_maxAccel);
+  tracer.SetStepsize(p_firstStep);
+
+  EquationSystem system(p_prior);
+  auto function = [&system](const Vector<double> &p_point, Vector<double> &p_lhs) {
+    system.GetValue(p_point, p_lhs);
+  };
+  auto jacobian = [&system](const Vector<double> &p_point, Matrix<double> &p_jac) {
+    system.GetJacobian(p_point, p_jac);
+  };
+
+  // The orientation of the tangent computed by the tracer is arbitrary; take
+  // one step to determine the orientation in which t increases from zero.
+  Vector<double> x(system.GetStartPoint()), probe(x);
+  double omega = 1.0;
+  tracer.TracePath(function, jacobian, probe, omega,
+                   [](const Vector<double> &p_point) { return p_point.back() != 0.0; });
+  if (probe.back() < 0.0) {
+    omega = -1.0;
+  }
+
+  List<TracingMixedStrategyProfile> profiles;
+  tracer.TracePath(
+      function, jacobian, x, omega,
+      [](const Vector<double> &p_point) { return p_point.back() < 0.0; },
+      [&system, &profiles, &p_observer](const Vector<double> &p_point) {
+        profiles.push_back(
+            TracingMixedStrategyProfile(system.GetProfile(p_point), p_point.back()));
+        p_observer(profiles.back());
+      },
+      [](const Vector<double> &p_point, const Vector<double> &) -> double {
+        return p_point.back() - 1.0;
+      });
+  if (RefineEndpoint(system, x)) {
+    profiles.push_back(TracingMixedStrategyProfile(system.GetProfile(x), x.back()));
+    p_observer(profiles.back());
+  }
+  return profiles;
+}
+
+} // end namespace Gambit
@@ -0,0 +1,77 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/solvers/tracing/tracing.h
+// Compute Nash equilibria using the linear tracing procedure
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef SOLVERS_TRACING_H
+#define SOLVERS_TRACING_H
+
+#include <functional>
+
+namespace Gambit {
+
+// A point on the path followed by the tracing procedure: a mixed strategy
+// profile, together with the value of the homotopy parameter t, which runs
+// from zero (where players respond to the prior) to one (a Nash equilibrium).
+class TracingMixedStrategyProfile {
+public:
+  explicit TracingMixedStrategyProfile(const Game &p_game)
+    : m_profile(p_game->NewMixedStrategyProfile(0.0)), m_parameter(0.0)
+  {
+  }
+  TracingMixedStrategyProfile(const MixedStrategyProfile<double> &p_profile, double p_parameter)
+    : m_profile(p_profile), m_parameter(p_parameter)
+  {
+  }
+  TracingMixedStrategyProfile(const TracingMixedStrategyProfile &) = default;
+  ~TracingMixedStrategyProfile() = default;
+
+  double GetParameter() const { return m_parameter; }
+
+  const MixedStrategyProfile<double> &GetProfile() const { return m_profile; }
+
+  Game GetGame() const { return m_profile.GetGame(); }
+
+  size_t size() const { return m_profile.MixedProfileLength(); }
+
+  double operator[](int i) const { return m_profile[i]; }
+
+private:
+  MixedStrategyProfile<double> m_profile;
+  double m_parameter;
+};
+
+using TracingObserverFunctionType = std::function<void(const TracingMixedStrategyProfile &)>;
+
+inline void NullTracingObserver(const TracingMixedStrategyProfile &) {}
+
+// Follows the path of the linear tracing procedure of Harsanyi and Selten,
+// starting from the prior p_prior, to a Nash equilibrium.  The path is
+// smoothed using the logarithmic penalty of Herings and Peeters (2001),
+// whose weight vanishes as the equilibrium is approached.  Every point
+// computed is passed to p_observer; the last point in the returned list
+// is the equilibrium selected.
+List<TracingMixedStrategyProfile>
+TracingStrategySolve(const MixedStrategyProfile<double> &p_prior, double p_firstStep,
+                     double p_maxAccel, TracingObserverFunctionType p_observer = NullTracingObserver);
+
+} // namespace Gambit
+
+#endif // SOLVERS_TRACING_H
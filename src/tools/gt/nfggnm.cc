@@ -62,7 +62,13 @@ void PrintHelp(char *progname)
             << std::to_string(GNM_LOCAL_NEWTON_MAXITS_DEFAULT) << ")\n";
   std::cerr << "  -c STEPS         number of steps in each support cell (default "
             << std::to_string(GNM_STEPS_DEFAULT) << ")\n";
+  std::cerr << "  -t THREADS       number of rays to follow concurrently (default 1;\n";
+  std::cerr << "                   0 uses all hardware threads)\n";
+  std::cerr << "  -e EQA           terminate after finding EQA distinct equilibria\n";
+  std::cerr << "  -T SECONDS       stop following rays after SECONDS seconds\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
+  std::cerr << "  -y, --symmetric  compute symmetric equilibria (for action graph games,\n";
+  std::cerr << "                   players with the same actions play the same strategy)\n";
   std::cerr << "  -V, --verbose    verbose mode (shows intermediate output)\n";
   std::cerr << "  -v, --version    print version information\n";
   exit(1);
@@ -71,22 +77,25 @@ void PrintHelp(char *progname)
 int main(int argc, char *argv[])
 {
   opterr = 0;
-  bool quiet = false, verbose = false;
+  bool quiet = false, verbose = false, symmetric = false;
   int numDecimals = 6, numVectors = 1;
   double lambdaEnd = GNM_LAMBDA_END_DEFAULT;
   int localNewtonInterval = GNM_LOCAL_NEWTON_INTERVAL_DEFAULT;
   int localNewtonMaxits = GNM_LOCAL_NEWTON_MAXITS_DEFAULT;
   int steps = GNM_STEPS_DEFAULT;
+  int numThreads = 1, maxEquilibria = 0;
+  double maxSeconds = 0.0;
   std::string startFile;
 
   int long_opt_index = 0;
   struct option long_options[] = {{"help", 0, nullptr, 'h'},
                                   {"version", 0, nullptr, 'v'},
                                   {"verbose", 0, nullptr, 'V'},
+                                  {"symmetric", 0, nullptr, 'y'},
                                   {nullptr, 0, nullptr, 0}};
   int c;
-  while ((c = getopt_long(argc, argv, "d:n:s:m:f:i:c:qvVhS", long_options, &long_opt_index)) !=
-         -1) {
+  while ((c = getopt_long(argc, argv, "d:n:s:m:f:i:c:t:e:T:qvVhSy", long_options,
+                          &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -118,8 +127,20 @@ int main(int argc, char *argv[])
     case 'c':
       steps = atoi(optarg);
       break;
+    case 't':
+      numThreads = atoi(optarg);
+      break;
+    case 'e':
+      maxEquilibria = atoi(optarg);
+      break;
+    case 'T':
+      maxSeconds = atof(optarg);
+      break;
     case 'S':
       break;
+    case 'y':
+      symmetric = true;
+      break;
     case 'h':
       PrintHelp(argv[0]);
       break;
@@ -156,6 +177,10 @@ int main(int argc, char *argv[])
     std::cerr << "Error: Value for -c (steps in support cell) must be at least 1\n";
     return 1;
   }
+  if (numThreads < 0) {
+    std::cerr << "Error: Value for -t (number of threads) must not be negative\n";
+    return 1;
+  }
 
   std::istream *input_stream = &std::cin;
   std::ifstream file_stream;
@@ -184,15 +209,15 @@ int main(int argc, char *argv[])
       // Generate the desired number of points randomly
       perts = RandomStrategyPerturbations(game, numVectors);
     }
-    for (auto pert : perts) {
-      GNMStrategySolve(pert, lambdaEnd, steps, localNewtonInterval, localNewtonMaxits,
-                       [renderer, verbose](const MixedStrategyProfile<double> &p_profile,
-                                           const std::string &p_label) {
-                         if (p_label == "NE" || verbose) {
-                           renderer->Render(p_profile, p_label);
-                         }
-                       });
-    }
+    auto callback = [renderer, verbose](const MixedStrategyProfile<double> &p_profile,
+                                        const std::string &p_label) {
+      if (p_label == "NE" || verbose) {
+        renderer->Render(p_profile, p_label);
+      }
+    };
+    GNMStrategySolve(perts, lambdaEnd, steps, localNewtonInterval, localNewtonMaxits, numThreads,
+                     maxEquilibria, maxSeconds, GNM_EQUILIBRIUM_TOLERANCE_DEFAULT, symmetric,
+                     callback);
     return 0;
   }
   catch (std::exception &e) {
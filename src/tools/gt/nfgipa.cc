@@ -55,6 +55,8 @@ void PrintHelp(char *progname)
   std::cerr << "  -n COUNT         number of perturbation vectors to generate\n";
   std::cerr << "  -s FILE          file containing perturbation vectors\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
+  std::cerr << "  -y, --symmetric  compute symmetric equilibria (for action graph games,\n";
+  std::cerr << "                   players with the same actions play the same strategy)\n";
   std::cerr << "  -V, --verbose    verbose mode (shows intermediate output)\n";
   std::cerr << "  -v, --version    print version information\n";
   exit(1);
@@ -63,7 +65,7 @@ void PrintHelp(char *progname)
 int main(int argc, char *argv[])
 {
   opterr = 0;
-  bool quiet = false, verbose = false;
+  bool quiet = false, verbose = false, symmetric = false;
   int numDecimals = 6, numVectors = 1;
   std::string startFile;
 
@@ -71,9 +73,10 @@ int main(int argc, char *argv[])
   struct option long_options[] = {{"help", 0, nullptr, 'h'},
                                   {"version", 0, nullptr, 'v'},
                                   {"verbose", 0, nullptr, 'V'},
+                                  {"symmetric", 0, nullptr, 'y'},
                                   {nullptr, 0, nullptr, 0}};
   int c;
-  while ((c = getopt_long(argc, argv, "d:n:s:vVqhS", long_options, &long_opt_index)) != -1) {
+  while ((c = getopt_long(argc, argv, "d:n:s:vVqhSy", long_options, &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -92,6 +95,9 @@ int main(int argc, char *argv[])
       break;
     case 'S':
       break;
+    case 'y':
+      symmetric = true;
+      break;
     case 'h':
       PrintHelp(argv[0]);
       break;
@@ -140,13 +146,19 @@ int main(int argc, char *argv[])
       perts = RandomStrategyPerturbations(game, numVectors);
     }
 
+    auto callback = [renderer, verbose](const MixedStrategyProfile<double> &p_profile,
+                                        const std::string &p_label) {
+      if (p_label == "NE" || verbose) {
+        renderer->Render(p_profile, p_label);
+      }
+    };
     for (auto pert : perts) {
-      IPAStrategySolve(pert, [renderer, verbose](const MixedStrategyProfile<double> &p_profile,
-                                                 const std::string &p_label) {
-        if (p_label == "NE" || verbose) {
-          renderer->Render(p_profile, p_label);
-        }
-      });
+      if (symmetric) {
+        IPASymmetricStrategySolve(pert, callback);
+      }
+      else {
+        IPAStrategySolve(pert, callback);
+      }
     }
     return 0;
   }
@@ -24,6 +24,8 @@
 #include <iostream>
 #include <fstream>
 #include <cstdlib>
+#include <map>
+#include <memory>
 #include <getopt.h>
 #include "gambit.h"
 #include "solvers/logit/logit.h"
@@ -57,6 +59,9 @@ void PrintHelp(char *progname)
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
   std::cerr << "  -e               print only the terminal equilibrium\n";
   std::cerr << "                   (default is to print the entire branch)\n";
+  std::cerr << "  -y, --symmetric  trace the branch of symmetric profiles of a symmetric game\n";
+  std::cerr << "  -T FILE          write details of each step of the tracing to FILE,\n";
+  std::cerr << "                   as JSON if FILE ends in .json, otherwise as CSV\n";
   std::cerr << "  -v, --version    print version information\n";
   exit(1);
 }
@@ -105,26 +110,89 @@ void PrintProfile(std::ostream &p_stream, int p_decimals, const T &p_profile, bo
   p_stream << std::endl;
 }
 
+//
+// Writes the details of each step attempted in tracing the branch, one
+// step per line, either as CSV or as a JSON array of objects.
+//
+class StepTraceWriter {
+public:
+  StepTraceWriter(std::ostream &p_stream, bool p_json) : m_stream(p_stream), m_json(p_json)
+  {
+    if (m_json) {
+      m_stream << "[\n";
+    }
+    else {
+      m_stream << "step,result,stepsize,lambda,iterations,distance,contraction,perturbed,"
+                  "jacobian_time\n";
+    }
+  }
+  ~StepTraceWriter()
+  {
+    if (m_json) {
+      m_stream << ((m_count > 0) ? "\n]\n" : "]\n");
+    }
+  }
+
+  void Write(const PathTracerStep &p_step);
+
+private:
+  std::ostream &m_stream;
+  bool m_json;
+  int m_count{0};
+};
+
+void StepTraceWriter::Write(const PathTracerStep &p_step)
+{
+  static const std::map<PathTracerStepResult, std::string> results = {
+      {PathTracerStepResult::Accepted, "accepted"},
+      {PathTracerStepResult::RejectedDistance, "distance"},
+      {PathTracerStepResult::RejectedContraction, "contraction"},
+      {PathTracerStepResult::RejectedOrientation, "orientation"},
+      {PathTracerStepResult::CorrectorLimit, "corrector-limit"}};
+  const std::string &result = results.at(p_step.m_result);
+  m_stream << std::setprecision(10);
+  if (m_json) {
+    m_stream << ((m_count > 0) ? ",\n" : "") << "{\"step\": " << m_count + 1 << ", \"result\": \""
+             << result << "\", \"stepsize\": " << p_step.m_stepsize
+             << ", \"lambda\": " << p_step.m_parameter
+             << ", \"iterations\": " << p_step.m_iterations
+             << ", \"distance\": " << p_step.m_distance
+             << ", \"contraction\": " << p_step.m_contraction
+             << ", \"perturbed\": " << ((p_step.m_perturbed) ? "true" : "false")
+             << ", \"jacobian_time\": " << p_step.m_jacobianTime << "}";
+  }
+  else {
+    m_stream << m_count + 1 << "," << result << "," << p_step.m_stepsize << ","
+             << p_step.m_parameter << "," << p_step.m_iterations << "," << p_step.m_distance
+             << "," << p_step.m_contraction << "," << ((p_step.m_perturbed) ? 1 : 0) << ","
+             << p_step.m_jacobianTime << "\n";
+  }
+  m_count++;
+}
+
 int main(int argc, char *argv[])
 {
   opterr = 0;
 
-  bool quiet = false, useStrategic = false;
+  bool quiet = false, useStrategic = false, symmetric = false;
   double maxLambda = 1000000.0;
   double maxregret = 1.0e-8;
   std::string mleFile;
   double maxDecel = 1.1;
   double hStart = 0.03;
   std::list<double> targetLambda;
+  std::string traceFile;
   bool fullGraph = true;
   int decimals = 6;
 
   int long_opt_index = 0;
-  struct option long_options[] = {
-      {"help", 0, nullptr, 'h'}, {"version", 0, nullptr, 'v'}, {nullptr, 0, nullptr, 0}};
+  struct option long_options[] = {{"help", 0, nullptr, 'h'},
+                                  {"version", 0, nullptr, 'v'},
+                                  {"symmetric", 0, nullptr, 'y'},
+                                  {nullptr, 0, nullptr, 0}};
   int c;
-  while ((c = getopt_long(argc, argv, "d:s:a:m:vqehSL:p:l:", long_options, &long_opt_index)) !=
-         -1) {
+  while ((c = getopt_long(argc, argv, "d:s:a:m:vqehSyL:p:l:T:", long_options,
+                          &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -153,12 +221,19 @@ int main(int argc, char *argv[])
     case 'S':
       useStrategic = true;
       break;
+    case 'y':
+      symmetric = true;
+      useStrategic = true;
+      break;
     case 'L':
       mleFile = optarg;
       break;
     case 'l':
       targetLambda.push_back(atof(optarg));
       break;
+    case 'T':
+      traceFile = optarg;
+      break;
     case '?':
       if (isprint(optopt)) {
         std::cerr << argv[0] << ": Unknown option `-" << ((char)optopt) << "'.\n";
@@ -189,6 +264,25 @@ int main(int argc, char *argv[])
     input_stream = &file_stream;
   }
 
+  std::ofstream traceStream;
+  std::unique_ptr<StepTraceWriter> traceWriter;
+  StepObserverFunctionType stepObserver = NullStepObserver;
+  if (!traceFile.empty()) {
+    traceStream.open(traceFile);
+    if (!traceStream.is_open()) {
+      std::ostringstream error_message;
+      error_message << argv[0] << ": " << traceFile;
+      perror(error_message.str().c_str());
+      exit(1);
+    }
+    const std::string suffix = ".json";
+    const bool json = traceFile.size() >= suffix.size() &&
+                      traceFile.compare(traceFile.size() - suffix.size(), suffix.size(),
+                                        suffix) == 0;
+    traceWriter = std::make_unique<StepTraceWriter>(traceStream, json);
+    stepObserver = [&traceWriter](const PathTracerStep &p_step) { traceWriter->Write(p_step); };
+  }
+
   try {
     Game game = ReadGame(*input_stream);
     if (!game->IsPerfectRecall()) {
@@ -196,6 +290,11 @@ int main(int argc, char *argv[])
           "Computing equilibria of games with imperfect recall is not supported.");
     }
 
+    if (symmetric && (!mleFile.empty() || !targetLambda.empty())) {
+      throw UndefinedException(
+          "Estimation and computation at given lambda are not supported for symmetric branches.");
+    }
+
     if (!mleFile.empty() && (!game->IsTree() || useStrategic)) {
       MixedStrategyProfile<double> frequencies(game->NewMixedStrategyProfile(0.0));
       std::ifstream mleData(mleFile.c_str());
@@ -220,14 +319,20 @@ int main(int argc, char *argv[])
       };
       LogitQREMixedStrategyProfile start(game);
       if (!targetLambda.empty()) {
-        auto result =
-            LogitStrategySolveLambda(start, targetLambda, 1.0, hStart, maxDecel, printer);
+        auto result = LogitStrategySolveLambda(start, targetLambda, 1.0, hStart, maxDecel,
+                                               printer, stepObserver);
         for (auto &profile : result) {
           PrintProfile(std::cout, decimals, profile);
         }
       }
+      else if (symmetric) {
+        auto result = LogitSymmetricStrategySolve(start, maxregret, 1.0, hStart, maxDecel,
+                                                  printer, stepObserver);
+        PrintProfile(std::cout, decimals, result.back(), true);
+      }
       else {
-        auto result = LogitStrategySolve(start, maxregret, 1.0, hStart, maxDecel, printer);
+        auto result = LogitStrategySolve(start, maxregret, 1.0, hStart, maxDecel, printer,
+                                         stepObserver);
         PrintProfile(std::cout, decimals, result.back(), true);
       }
     }
@@ -239,14 +344,15 @@ int main(int argc, char *argv[])
       };
       LogitQREMixedBehaviorProfile start(game);
       if (!targetLambda.empty()) {
-        auto result =
-            LogitBehaviorSolveLambda(start, targetLambda, 1.0, hStart, maxDecel, printer);
+        auto result = LogitBehaviorSolveLambda(start, targetLambda, 1.0, hStart, maxDecel,
+                                               printer, stepObserver);
         for (auto &profile : result) {
           PrintProfile(std::cout, decimals, profile);
         }
       }
       else {
-        auto result = LogitBehaviorSolve(start, maxregret, 1.0, hStart, maxDecel, printer);
+        auto result = LogitBehaviorSolve(start, maxregret, 1.0, hStart, maxDecel, printer,
+                                         stepObserver);
         PrintProfile(std::cout, decimals, result.back(), true);
       }
     }
@@ -106,6 +106,8 @@ void PrintHelp(char *progname)
   std::cerr << "With no options, computes one approximate Nash equilibrium.\n\n";
 
   std::cerr << "Options:\n";
+  std::cerr << "  -f, --floating-point\n";
+  std::cerr << "                   subdivide in floating point, checking the result exactly\n";
   std::cerr << "  -g MULT          granularity of grid refinement at each step (default is 2)\n";
   std::cerr << "  -h, --help       print this help message\n";
   std::cerr << "  -r DENOM         generate random starting points with denominator DENOM\n";
@@ -116,6 +118,7 @@ void PrintHelp(char *progname)
   std::cerr << "  -m MAXREGRET     maximum regret acceptable as a proportion of range of\n";
   std::cerr << "                   payoffs in the game\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
+  std::cerr << "  -y, --symmetric  compute a symmetric equilibrium of a symmetric game\n";
   std::cerr << "  -V, --verbose    verbose mode (shows intermediate output)\n";
   std::cerr << "  -v, --version    print version information\n";
   std::cerr << "                   (default is to only show equilibria)\n";
@@ -128,16 +131,19 @@ int main(int argc, char *argv[])
   std::string startFile;
   bool useRandom = false;
   int randDenom = 1, gridResize = 2, stopAfter = 1, decimals = 0;
-  bool verbose = false, quiet = false;
+  bool verbose = false, quiet = false, symmetric = false, floatingPoint = false;
   Rational maxregret(1, 10000000);
 
   int long_opt_index = 0;
   struct option long_options[] = {{"help", 0, nullptr, 'h'},
                                   {"version", 0, nullptr, 'v'},
                                   {"verbose", 0, nullptr, 'V'},
+                                  {"symmetric", 0, nullptr, 'y'},
+                                  {"floating-point", 0, nullptr, 'f'},
                                   {nullptr, 0, nullptr, 0}};
   int c;
-  while ((c = getopt_long(argc, argv, "g:hVvn:r:s:m:d:qS", long_options, &long_opt_index)) != -1) {
+  while ((c = getopt_long(argc, argv, "g:hVvn:r:s:m:d:qSyf", long_options, &long_opt_index)) !=
+         -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -172,6 +178,12 @@ int main(int argc, char *argv[])
       break;
     case 'S':
       break;
+    case 'y':
+      symmetric = true;
+      break;
+    case 'f':
+      floatingPoint = true;
+      break;
     case '?':
       if (isprint(optopt)) {
         std::cerr << argv[0] << ": Unknown option `-" << ((char)optopt) << "'.\n";
@@ -219,15 +231,20 @@ int main(int argc, char *argv[])
         starts[1][game->GetPlayer(pl)->GetStrategies()[1]] = Rational(1);
       }
     }
+    std::shared_ptr<StrategyProfileRenderer<Rational>> renderer;
+    if (decimals > 0) {
+      renderer = std::make_shared<MixedStrategyCSVAsFloatRenderer>(std::cout, decimals);
+    }
+    else {
+      renderer = std::make_shared<MixedStrategyCSVRenderer<Rational>>(std::cout);
+    }
+    const NashSimpdivStrategySolver algorithm(gridResize, 0, maxregret, verbose, renderer,
+                                              floatingPoint);
     for (auto start : starts) {
-      if (decimals > 0) {
-        auto renderer = std::make_shared<MixedStrategyCSVAsFloatRenderer>(std::cout, decimals);
-        NashSimpdivStrategySolver algorithm(gridResize, 0, maxregret, verbose, renderer);
-        algorithm.Solve(start);
+      if (symmetric) {
+        algorithm.SolveSymmetric(start);
       }
       else {
-        auto renderer = std::make_shared<MixedStrategyCSVRenderer<Rational>>(std::cout);
-        NashSimpdivStrategySolver algorithm(gridResize, 0, maxregret, verbose, renderer);
         algorithm.Solve(start);
       }
     }
@@ -0,0 +1,219 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2025, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/tools/tracing/tracing.cc
+// Command-line driver program for the linear tracing procedure
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <random>
+#include <getopt.h>
+#include "gambit.h"
+#include "solvers/tracing/tracing.h"
+
+using namespace Gambit;
+
+void PrintBanner(std::ostream &p_stream)
+{
+  p_stream << "Compute Nash equilibria using the linear tracing procedure\n";
+  p_stream << "Gambit version " VERSION ", ";
+  p_stream << "Copyright (C) 1994-2025, The Gambit Project\n";
+  p_stream << "This is free software, distributed under the GNU GPL\n\n";
+}
+
+void PrintHelp(char *progname)
+{
+  PrintBanner(std::cerr);
+  std::cerr << "Usage: " << progname << " [OPTIONS] [file]\n";
+  std::cerr << "If file is not specified, attempts to read game from standard input.\n";
+  std::cerr << "With no options, traces the path starting from the centroid as prior.\n";
+  std::cerr << "Extensive games are solved using their reduced strategic form.\n";
+
+  std::cerr << "Options:\n";
+  std::cerr << "  -d DECIMALS      show equilibria as floating point with DECIMALS digits\n";
+  std::cerr << "  -s STEP          initial stepsize (default is .03)\n";
+  std::cerr << "  -a ACCEL         maximum acceleration (default is 1.1)\n";
+  std::cerr << "  -n COUNT         number of priors to generate randomly\n";
+  std::cerr << "  -p FILE          file containing priors, one per line\n";
+  std::cerr << "  -h, --help       print this help message\n";
+  std::cerr << "  -q               quiet mode (suppresses banner)\n";
+  std::cerr << "  -e               print only the terminal equilibrium\n";
+  std::cerr << "                   (default is to print the entire path)\n";
+  std::cerr << "  -v, --version    print version information\n";
+  exit(1);
+}
+
+List<MixedStrategyProfile<double>> ReadStrategyProfiles(const Game &p_game, std::istream &p_stream)
+{
+  List<MixedStrategyProfile<double>> profiles;
+  while (true) {
+    MixedStrategyProfile<double> p(p_game->NewMixedStrategyProfile(0.0));
+    for (size_t i = 1; i <= p.MixedProfileLength(); i++) {
+      p_stream >> p[i];
+      if (i < p.MixedProfileLength()) {
+        char comma;
+        p_stream >> comma;
+      }
+    }
+    if (p_stream.fail()) {
+      break;
+    }
+    // Read in the rest of the line and discard
+    std::string foo;
+    std::getline(p_stream, foo);
+    profiles.push_back(p);
+  }
+  return profiles;
+}
+
+List<MixedStrategyProfile<double>> RandomStrategyProfiles(const Game &p_game, int p_count)
+{
+  std::default_random_engine engine;
+  List<MixedStrategyProfile<double>> profiles;
+  for (int i = 1; i <= p_count; i++) {
+    profiles.push_back(p_game->NewRandomStrategyProfile(engine));
+  }
+  return profiles;
+}
+
+void PrintProfile(std::ostream &p_stream, int p_decimals,
+                  const TracingMixedStrategyProfile &p_profile, bool p_nash = false)
+{
+  if (p_nash) {
+    p_stream << "NE";
+  }
+  else {
+    p_stream.setf(std::ios::fixed);
+    p_stream << std::setprecision(p_decimals) << p_profile.GetParameter();
+    p_stream.unsetf(std::ios::fixed);
+  }
+  for (size_t i = 1; i <= p_profile.size(); i++) {
+    p_stream << "," << std::setprecision(p_decimals) << p_profile[i];
+  }
+  p_stream << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+  opterr = 0;
+
+  bool quiet = false;
+  double maxDecel = 1.1;
+  double hStart = 0.03;
+  bool fullGraph = true;
+  int decimals = 6;
+  int numPriors = 0;
+  std::string priorFile;
+
+  int long_opt_index = 0;
+  struct option long_options[] = {
+      {"help", 0, nullptr, 'h'}, {"version", 0, nullptr, 'v'}, {nullptr, 0, nullptr, 0}};
+  int c;
+  while ((c = getopt_long(argc, argv, "d:s:a:n:p:vqeh", long_options, &long_opt_index)) !=
+         -1) {
+    switch (c) {
+    case 'v':
+      PrintBanner(std::cerr);
+      exit(1);
+    case 'q':
+      quiet = true;
+      break;
+    case 'd':
+      decimals = atoi(optarg);
+      break;
+    case 's':
+      hStart = atof(optarg);
+      break;
+    case 'a':
+      maxDecel = atof(optarg);
+      break;
+    case 'n':
+      numPriors = atoi(optarg);
+      break;
+    case 'p':
+      priorFile = optarg;
+      break;
+    case 'e':
+      fullGraph = false;
+      break;
+    case 'h':
+      PrintHelp(argv[0]);
+      break;
+    case '?':
+      if (isprint(optopt)) {
+        std::cerr << argv[0] << ": Unknown option `-" << ((char)optopt) << "'.\n";
+      }
+      else {
+        std::cerr << argv[0] << ": Unknown option character `\\x" << optopt << "`.\n";
+      }
+      return 1;
+    default:
+      abort();
+    }
+  }
+
+  if (!quiet) {
+    PrintBanner(std::cerr);
+  }
+
+  std::istream *input_stream = &std::cin;
+  std::ifstream file_stream;
+  if (optind < argc) {
+    file_stream.open(argv[optind]);
+    if (!file_stream.is_open()) {
+      std::ostringstream error_message;
+      error_message << argv[0] << ": " << argv[optind];
+      perror(error_message.str().c_str());
+      exit(1);
+    }
+    input_stream = &file_stream;
+  }
+
+  try {
+    Game game = ReadGame(*input_stream);
+
+    List<MixedStrategyProfile<double>> priors;
+    if (!priorFile.empty()) {
+      std::ifstream priorStream(priorFile.c_str());
+      priors = ReadStrategyProfiles(game, priorStream);
+    }
+    else if (numPriors > 0) {
+      priors = RandomStrategyProfiles(game, numPriors);
+    }
+    else {
+      priors.push_back(game->NewMixedStrategyProfile(0.0));
+    }
+
+    auto printer = [fullGraph, decimals](const TracingMixedStrategyProfile &p) {
+      if (fullGraph) {
+        PrintProfile(std::cout, decimals, p);
+      }
+    };
+    for (const auto &prior : priors) {
+      auto result = TracingStrategySolve(prior, hStart, maxDecel, printer);
+      PrintProfile(std::cout, decimals, result.back(), true);
+    }
+    return 0;
+  }
+  catch (std::runtime_error &e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+}